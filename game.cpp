@@ -4,10 +4,24 @@
 #include <chrono>       
 #include <algorithm>    
 #include <string>
+#include <thread>
 #include <stack>        
+#include <deque>
+#include <mutex>
 #include <queue>        
 #include <map>          
 #include <functional>   
+#include <atomic>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <new>
+#include <type_traits>
 
 using namespace std;
 
@@ -15,7 +29,7 @@ using namespace std;
 #include "raygui.h" 
 
 // --- Game States & Settings ---
-typedef enum GameScreen { HOME = 0, LEVEL_SELECT, GAMEPLAY, WIN, GAMEOVER } GameScreen;
+typedef enum GameScreen { HOME = 0, LEVEL_SELECT, GAMEPLAY, WIN, GAMEOVER, EDITOR } GameScreen;
 GameScreen currentScreen = HOME; 
 
 const int fixedScreenWidth = 1280; 
@@ -26,14 +40,31 @@ int mazeWidth = 51;
 int mazeHeight = 25; 
 const int TILE_SIZE = 20; 
 
+const int LEVEL_COUNT = 5; // One level per maze generator
+
 // The time limit for each level in seconds. You can adjust these values.
-const float levelTimeLimits[] = {50.0f, 100.0f, 165.0f, 210.0f};
+const float levelTimeLimits[] = {50.0f, 100.0f, 165.0f, 210.0f, 240.0f};
 
 int mazeOffsetX = 0;
 int mazeOffsetY = 0;
 
+// Row-major view of the current maze. Storage comes from the level arena, and
+// maze[y][x] indexing works the same as it did with nested vectors.
+struct MazeGrid {
+    char* cells = nullptr;
+    int width = 0;
+    int height = 0;
+
+    char* operator[](int y) { return cells + (size_t)y * width; }
+    const char* operator[](int y) const { return cells + (size_t)y * width; }
+
+    // Same accessors as TiledGridStore, so grid-generic kernels accept either
+    char Get(int x, int y) const { return cells[(size_t)y * width + x]; }
+    void Set(int x, int y, char value) { cells[(size_t)y * width + x] = value; }
+};
+
 // Gameplay Variables
-vector<vector<char>> maze; 
+MazeGrid maze; 
 int playerX, playerY;
 int exitX, exitY;
 float totalTime = 0.0f; 
@@ -46,7 +77,7 @@ const float playerMoveSpeed = 10.0f; // প্লেয়ারের স্ম
 float pulseTimer = 0.0f;            // এগজিট সাইন পালসিং এর জন্য টাইমার
 
 int currentLevelIndex = 0; 
-const char* levelNames[] = {"Easy", "Medium", "Hard", "Very Hard"};
+const char* levelNames[] = {"Easy", "Medium", "Hard", "Very Hard", "Long Walls"};
 
 // --- New Enum for Entrance/Exit Strategies ---
 typedef enum EntranceExitStrategy { 
@@ -63,10 +94,15 @@ struct TextAnimation {
     float typingSpeed; 
     int currentDisplayCharIndex;
     bool animationComplete;
+    int fontSize;
+    int textWidth; // Width of displayedText, re-measured only when a character is added
 
-    void Start(const string& text, float speed) {
+    void Start(const string& text, float speed, int size) {
         fullText = text;
-        displayedText = "";
+        fontSize = size;
+        textWidth = 0;
+        displayedText.clear();
+        displayedText.reserve(fullText.length()); // Typing never reallocates mid-animation
         typingTimer = 0.0f;
         typingSpeed = speed;
         currentDisplayCharIndex = 0;
@@ -84,6 +120,7 @@ struct TextAnimation {
                 displayedText += fullText[i];
             }
             currentDisplayCharIndex = targetChars;
+            textWidth = MeasureText(displayedText.c_str(), fontSize);
         }
 
         if (currentDisplayCharIndex >= fullText.length()) {
@@ -99,14 +136,20 @@ struct ScrambleTextEffect {
     float effectDuration;
     bool isActive;
     mt19937* rngPtr; 
+    int fontSize;
+    int originalWidth; // Measured once in Init
+    int textWidth;     // Width of scrambledText, re-measured only when it changes
 
-    void Init(const string& text, mt19937* rng) {
+    void Init(const string& text, mt19937* rng, int size) {
         originalText = text;
         scrambledText = text;
         effectTimer = 0.0f;
         effectDuration = 0.1f; 
         isActive = false;
         rngPtr = rng;
+        fontSize = size;
+        originalWidth = MeasureText(originalText.c_str(), fontSize);
+        textWidth = originalWidth;
     }
 
     void Start() {
@@ -117,12 +160,15 @@ struct ScrambleTextEffect {
     }
 
     void Stop() {
+        if (!isActive) return;
         isActive = false;
         scrambledText = originalText; 
+        textWidth = originalWidth;
     }
 
-    string GetText(float dt) {
-        if (!isActive) return originalText;
+    // Advances the effect. Called once per frame from the update pass.
+    void Update(float dt) {
+        if (!isActive) return;
 
         effectTimer += dt;
         if (effectTimer >= effectDuration) {
@@ -135,79 +181,290 @@ struct ScrambleTextEffect {
                 int indexToScramble = dist(*rngPtr);
                 scrambledText[indexToScramble] = static_cast<char>(char_dist(*rngPtr));
             }
+            textWidth = MeasureText(scrambledText.c_str(), fontSize);
             effectTimer = 0.0f; 
         }
+    }
+
+    // Returns a reference to the effect's own buffer so per-frame calls never copy the string.
+    const string& GetText() const {
         return scrambledText;
     }
 };
 
 TextAnimation welcomeTextAnim;
 ScrambleTextEffect pressEnterTextEffect;
-ScrambleTextEffect levelButtonsTextEffects[4]; 
+ScrambleTextEffect levelButtonsTextEffects[LEVEL_COUNT]; 
 
 Texture2D logoTexture; 
 
 mt19937 rng;
 
+// --- Allocation Instrumentation ---
+// Every heap allocation in the program goes through these, so any code path can be checked
+// for allocations by reading allocationCount before and after it.
+atomic<size_t> allocationCount{0};
+
+void* operator new(size_t size) {
+    allocationCount.fetch_add(1, memory_order_relaxed);
+    if (void* ptr = malloc(size ? size : 1)) return ptr;
+    throw bad_alloc();
+}
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+
+// Allocations seen during the last frame, and the highest count seen in a frame that
+// did not load a level or rebuild a screen layout. The steady-state number should stay at 0.
+size_t frameAllocations = 0;
+size_t peakSteadyFrameAllocations = 0;
+bool loadEventThisFrame = false;
+bool showFrameStats = false;
+
+// --- Per-Level Arena ---
+// Every per-maze structure (grid, generator scratch, BFS distances) is carved out of one
+// block that is released in a single Reset() when the next level is set up. The block keeps
+// its capacity, so replaying levels of the same size never touches the heap.
+struct LevelArena {
+    unsigned char* block = nullptr;
+    size_t capacity = 0;
+    size_t used = 0;
+    vector<unique_ptr<unsigned char[]>> overflow; // Requests that did not fit in the block
+
+    ~LevelArena() { free(block); }
+
+    void Reset(size_t expectedBytes) {
+        overflow.clear();
+        used = 0;
+        if (expectedBytes > capacity) {
+            free(block);
+            block = (unsigned char*)malloc(expectedBytes);
+            allocationCount.fetch_add(1, memory_order_relaxed);
+            capacity = block ? expectedBytes : 0;
+        }
+    }
+
+    template <typename T>
+    T* Allocate(size_t count) {
+        static_assert(is_trivially_destructible<T>::value, "Arena memory is released without running destructors");
+        size_t bytes = count * sizeof(T);
+        size_t offset = (used + alignof(T) - 1) & ~(alignof(T) - 1);
+        if (offset + bytes <= capacity) {
+            used = offset + bytes;
+            return reinterpret_cast<T*>(block + offset);
+        }
+        TraceLog(LOG_WARNING, "ARENA: %zu bytes did not fit in the level block, using an overflow allocation", bytes);
+        overflow.emplace_back(new unsigned char[bytes + alignof(T)]);
+        uintptr_t raw = reinterpret_cast<uintptr_t>(overflow.back().get());
+        return reinterpret_cast<T*>((raw + alignof(T) - 1) & ~(uintptr_t)(alignof(T) - 1));
+    }
+};
+
+LevelArena levelArena;
+
+size_t divisionStackBytes(int width, int height);
+
+// Upper bound of what one level draws from the arena: grid, generator scratch and BFS buffers.
+size_t levelArenaBytes(int width, int height) {
+    size_t cells = (size_t)width * height;
+    return cells * (sizeof(char) + 2 * sizeof(int) + 2 * sizeof(pair<int, int>)) + divisionStackBytes(width, height) + 256;
+}
+
+void resetMazeGrid() {
+    maze.width = mazeWidth;
+    maze.height = mazeHeight;
+    maze.cells = levelArena.Allocate<char>((size_t)mazeWidth * mazeHeight);
+    memset(maze.cells, '#', (size_t)mazeWidth * mazeHeight);
+}
+
+// --- Pluggable Random Number Engines ---
+// The generators take the engine as a template parameter, so anything that satisfies
+// UniformRandomBitGenerator works: mt19937 (default), PCG32 or Xoshiro256ss.
+
+// PCG32 (XSH-RR variant). Each odd increment selects an independent stream.
+struct PCG32 {
+    using result_type = uint32_t;
+    uint64_t state;
+    uint64_t inc;
+
+    explicit PCG32(uint64_t seedValue = 0x853c49e6748fea9bULL, uint64_t streamId = 0xda3e39cb94b95bdbULL) {
+        Seed(seedValue, streamId);
+    }
+
+    void Seed(uint64_t seedValue, uint64_t streamId) {
+        state = 0;
+        inc = (streamId << 1u) | 1u;
+        (*this)();
+        state += seedValue;
+        (*this)();
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT32_MAX; }
+
+    result_type operator()() {
+        uint64_t oldState = state;
+        state = oldState * 6364136223846793005ULL + inc;
+        uint32_t xorShifted = (uint32_t)(((oldState >> 18u) ^ oldState) >> 27u);
+        uint32_t rot = (uint32_t)(oldState >> 59u);
+        return (xorShifted >> rot) | (xorShifted << ((-rot) & 31));
+    }
+};
+
+// xoshiro256** seeded through splitmix64. Jump() advances 2^128 steps, which gives
+// non-overlapping streams for parallel workers.
+struct Xoshiro256ss {
+    using result_type = uint64_t;
+    uint64_t s[4];
+
+    explicit Xoshiro256ss(uint64_t seedValue = 0x9E3779B97F4A7C15ULL) { Seed(seedValue); }
+
+    void Seed(uint64_t seedValue) {
+        for (int i = 0; i < 4; ++i) {
+            seedValue += 0x9E3779B97F4A7C15ULL;
+            uint64_t z = seedValue;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            s[i] = z ^ (z >> 31);
+        }
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT64_MAX; }
+
+    static uint64_t Rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    result_type operator()() {
+        uint64_t result = Rotl(s[1] * 5, 7) * 9;
+        uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = Rotl(s[3], 45);
+        return result;
+    }
+
+    void Jump() {
+        static const uint64_t JUMP[] = { 0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL };
+        uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+        for (uint64_t jumpWord : JUMP) {
+            for (int b = 0; b < 64; ++b) {
+                if (jumpWord & (1ULL << b)) {
+                    s0 ^= s[0]; s1 ^= s[1]; s2 ^= s[2]; s3 ^= s[3];
+                }
+                (*this)();
+            }
+        }
+        s[0] = s0; s[1] = s1; s[2] = s2; s[3] = s3;
+    }
+};
+
+// Builds a reproducible engine for one worker: the same (seed, streamId) pair always gives
+// the same sequence, and different stream ids never share state.
+template <typename RNG> RNG makeRngStream(uint64_t seedValue, uint64_t streamId);
+
+template <> inline mt19937 makeRngStream<mt19937>(uint64_t seedValue, uint64_t streamId) {
+    seed_seq seq{ (uint32_t)seedValue, (uint32_t)(seedValue >> 32), (uint32_t)streamId, (uint32_t)(streamId >> 32) };
+    return mt19937(seq);
+}
+
+template <> inline PCG32 makeRngStream<PCG32>(uint64_t seedValue, uint64_t streamId) {
+    return PCG32(seedValue, streamId);
+}
+
+template <> inline Xoshiro256ss makeRngStream<Xoshiro256ss>(uint64_t seedValue, uint64_t streamId) {
+    Xoshiro256ss engine(seedValue);
+    for (uint64_t i = 0; i < streamId; ++i) engine.Jump();
+    return engine;
+}
+
 // --- Maze Generation Algorithms ---
 
+// All 24 orderings of the four directions. The carving kernels pick one row per cell
+// instead of shuffling a freshly allocated vector.
+const unsigned char directionPermutations[24][4] = {
+    {0,1,2,3}, {0,1,3,2}, {0,2,1,3}, {0,2,3,1}, {0,3,1,2}, {0,3,2,1},
+    {1,0,2,3}, {1,0,3,2}, {1,2,0,3}, {1,2,3,0}, {1,3,0,2}, {1,3,2,0},
+    {2,0,1,3}, {2,0,3,1}, {2,1,0,3}, {2,1,3,0}, {2,3,0,1}, {2,3,1,0},
+    {3,0,1,2}, {3,0,2,1}, {3,1,0,2}, {3,1,2,0}, {3,2,0,1}, {3,2,1,0}
+};
+
+size_t lastCarveAllocations = 0; // Allocations made inside the last carving loop (should be 0)
+
+// Scratch storage for the DFS stack / BFS queue. Each cell is pushed at most once, so one
+// slot per cell taken from the arena up front keeps the carving loop allocation-free.
+pair<int, int>* allocateCarveBuffer() {
+    return levelArena.Allocate<pair<int, int>>((size_t)((mazeWidth + 1) / 2) * ((mazeHeight + 1) / 2) + 1);
+}
+
 // Iterative DFS (Depth-First Search) maze generation to avoid stack overflow
-void generateMazeDFS(int startX, int startY) {
-    maze.assign(mazeHeight, vector<char>(mazeWidth, '#'));
-    stack<pair<int, int>> s;
-    s.push({startX, startY});
+template <typename RNG>
+void generateMazeDFS(int startX, int startY, RNG& gen) {
+    resetMazeGrid();
+    pair<int, int>* carveStack = allocateCarveBuffer();
+    size_t stackSize = 0;
+    size_t allocationsBefore = allocationCount.load(memory_order_relaxed);
+
+    carveStack[stackSize++] = {startX, startY};
     maze[startY][startX] = ' ';
 
-    int dX[] = {0, 0, 1, -1}; 
-    int dY[] = {-1, 1, 0, 0};
+    const int dX[] = {0, 0, 1, -1}; 
+    const int dY[] = {-1, 1, 0, 0};
+    uniform_int_distribution<int> permDist(0, 23);
     
-    while (!s.empty()) {
-        int x = s.top().first;
-        int y = s.top().second;
-        s.pop();
+    while (stackSize > 0) {
+        --stackSize;
+        int x = carveStack[stackSize].first;
+        int y = carveStack[stackSize].second;
 
-        vector<int> dirs = {0, 1, 2, 3};
-        shuffle(dirs.begin(), dirs.end(), rng);
+        const unsigned char* dirs = directionPermutations[permDist(gen)];
 
-        for (int i : dirs) {
+        for (int d = 0; d < 4; ++d) {
+            int i = dirs[d];
             int nextX = x + dX[i] * 2;
             int nextY = y + dY[i] * 2;
             int wallX = x + dX[i];
             int wallY = y + dY[i];
 
-            if (nextX >= 0 && nextX < mazeWidth && nextY >= 0 && nextY < mazeHeight && maze[nextY][nextX] == '#') {
+            if (nextX > 0 && nextX < mazeWidth - 1 && nextY > 0 && nextY < mazeHeight - 1 && maze[nextY][nextX] == '#') {
                 maze[wallY][wallX] = ' ';
                 maze[nextY][nextX] = ' ';
-                s.push({nextX, nextY});
+                carveStack[stackSize++] = {nextX, nextY};
             }
         }
     }
+    lastCarveAllocations = allocationCount.load(memory_order_relaxed) - allocationsBefore;
 }
 
 // BFS (Breadth-First Search) maze generation - Note: This is actually a randomized DFS with a queue.
-void generateMazeBFS(int startX, int startY) {
-    maze.assign(mazeHeight, vector<char>(mazeWidth, '#')); 
-    queue<pair<int, int>> q; 
-    q.push({startX, startY});
+template <typename RNG>
+void generateMazeBFS(int startX, int startY, RNG& gen) {
+    resetMazeGrid();
+    pair<int, int>* carveQueue = allocateCarveBuffer();
+    size_t head = 0, tail = 0; // Entries before 'head' have already been popped
+    size_t allocationsBefore = allocationCount.load(memory_order_relaxed);
+
+    carveQueue[tail++] = {startX, startY};
     maze[startY][startX] = ' ';
 
-    int dX[] = {0, 0, 1, -1}; 
-    int dY[] = {-1, 1, 0, 0};
+    const int dX[] = {0, 0, 1, -1}; 
+    const int dY[] = {-1, 1, 0, 0};
+    uniform_int_distribution<int> permDist(0, 23);
 
     // This BFS is a bit unusual for maze generation as it carves paths immediately.
     // A more common BFS for maze gen would typically involve building a 'frontier' of walls
     // or cells to visit and making decisions based on reaching unvisited areas.
     // This current implementation more closely resembles a randomized DFS if it were recursive,
     // but using a queue makes it iterative.
-    while (!q.empty()) {
-        pair<int, int> current = q.front();
-        q.pop();
+    while (head < tail) {
+        pair<int, int> current = carveQueue[head++];
         int x = current.first;
         int y = current.second;
-        vector<int> indices = {0, 1, 2, 3};
-        shuffle(indices.begin(), indices.end(), rng); 
+        const unsigned char* indices = directionPermutations[permDist(gen)];
 
-        for (int i : indices) {
+        for (int d = 0; d < 4; ++d) {
+            int i = indices[d];
             int nextX = x + dX[i]*2; // Move 2 steps to ensure we are connecting cells, not just adjacent walls
             int nextY = y + dY[i]*2; // This makes it similar to DFS style of carving
             int wallX = x + dX[i];
@@ -216,16 +473,17 @@ void generateMazeBFS(int startX, int startY) {
             if (nextX > 0 && nextX < mazeWidth-1 && nextY > 0 && nextY < mazeHeight-1 && maze[nextY][nextX] == '#') {
                 maze[wallY][wallX] = ' '; 
                 maze[nextY][nextX] = ' '; 
-                q.push({nextX, nextY});   
+                carveQueue[tail++] = {nextX, nextY};   
             }
         }
     }
+    lastCarveAllocations = allocationCount.load(memory_order_relaxed) - allocationsBefore;
 }
 
 
 // Kruskal's Algorithm maze generation
 void generateMazeKruskal() {
-    maze.assign(mazeHeight, vector<char>(mazeWidth, '#')); 
+    resetMazeGrid();
     for (int y = 1; y < mazeHeight - 1; y += 2) {
         for (int x = 1; x < mazeWidth - 1; x += 2) {
             maze[y][x] = ' ';
@@ -234,41 +492,42 @@ void generateMazeKruskal() {
     struct Edge {
         int x1, y1, x2, y2;
     };
-    vector<Edge> edges;
+    Edge* edges = levelArena.Allocate<Edge>((size_t)(mazeWidth / 2) * (mazeHeight / 2) * 2);
+    size_t edgeCount = 0;
     for (int y = 1; y < mazeHeight - 1; y += 2) {
         for (int x = 1; x < mazeWidth - 2; x += 2) {
-            edges.push_back({x, y, x + 2, y});
+            edges[edgeCount++] = {x, y, x + 2, y};
         }
     }
     for (int y = 1; y < mazeHeight - 2; y += 2) {
         for (int x = 1; x < mazeWidth - 1; x += 2) {
-            edges.push_back({x, y, x, y + 2});
+            edges[edgeCount++] = {x, y, x, y + 2};
         }
     }
-    shuffle(edges.begin(), edges.end(), rng);
+    shuffle(edges, edges + edgeCount, rng);
 
-    vector<int> parent;
-    parent.resize((mazeWidth / 2) * (mazeHeight / 2));
-    for (size_t i = 0; i < parent.size(); i++) parent[i] = i;
+    size_t setCount = (size_t)(mazeWidth / 2) * (mazeHeight / 2);
+    int* parent = levelArena.Allocate<int>(setCount);
+    for (size_t i = 0; i < setCount; i++) parent[i] = (int)i;
 
-    function<int(int)> findSet = 
+    // Iterative find with path halving (no recursion, no std::function)
+    auto findSet = 
         [&](int i) {
-            if (parent[i] == i) return i;
-            return parent[i] = findSet(parent[i]);
-        };
-    
-    function<void(int, int)> uniteSets = 
-        [&](int a, int b) {
-            a = findSet(a);
-            b = findSet(b);
-            if (a != b) parent[b] = a;
+            while (parent[i] != i) {
+                parent[i] = parent[parent[i]];
+                i = parent[i];
+            }
+            return i;
         };
 
-    for (const auto& edge : edges) {
+    for (size_t e = 0; e < edgeCount; ++e) {
+        const Edge& edge = edges[e];
         int cell1 = (edge.y1 / 2) * (mazeWidth / 2) + (edge.x1 / 2);
         int cell2 = (edge.y2 / 2) * (mazeWidth / 2) + (edge.x2 / 2);
-        if (findSet(cell1) != findSet(cell2)) {
-            uniteSets(cell1, cell2);
+        int set1 = findSet(cell1);
+        int set2 = findSet(cell2);
+        if (set1 != set2) {
+            parent[set2] = set1;
             maze[(edge.y1 + edge.y2) / 2][(edge.x1 + edge.x2) / 2] = ' ';
         }
     }
@@ -276,14 +535,16 @@ void generateMazeKruskal() {
 
 // Prim's Algorithm maze generation
 void generateMazePrim(int startX, int startY) {
-    maze.assign(mazeHeight, vector<char>(mazeWidth, '#'));
+    resetMazeGrid();
     
     // Ensure startX and startY are odd, as Prim's operates on a grid of cells (odd coords)
     startX = (startX / 2) * 2 + 1;
     startY = (startY / 2) * 2 + 1;
 
-    // A vector of walls to be considered
-    vector<pair<int, int>> frontier;
+    // The walls to be considered. Each carved cell adds at most four walls, so one slot
+    // per grid tile is always enough.
+    pair<int, int>* frontier = levelArena.Allocate<pair<int, int>>((size_t)mazeWidth * mazeHeight + 4);
+    size_t frontierSize = 0;
     
     // Start with a single cell and add its surrounding walls to the frontier
     maze[startY][startX] = ' '; 
@@ -294,18 +555,19 @@ void generateMazePrim(int startX, int startY) {
         int wallX = startX + dX[i];
         int wallY = startY + dY[i];
         if (wallX > 0 && wallX < mazeWidth-1 && wallY > 0 && wallY < mazeHeight-1) {
-            frontier.push_back({wallX, wallY});
+            frontier[frontierSize++] = {wallX, wallY};
         }
     }
 
     // Keep carving paths until there are no more walls in the frontier
-    while (!frontier.empty()) {
+    while (frontierSize > 0) {
         // Pick a random wall from the frontier
-        uniform_int_distribution<> dist_frontier(0, frontier.size() - 1);
+        uniform_int_distribution<> dist_frontier(0, frontierSize - 1);
         int rand_idx = dist_frontier(rng); 
         
+        // Order in the frontier does not matter, so remove by swapping in the last wall
         pair<int, int> currentWall = frontier[rand_idx];
-        frontier.erase(frontier.begin() + rand_idx);
+        frontier[rand_idx] = frontier[--frontierSize];
         
         int wallX = currentWall.first; 
         int wallY = currentWall.second;
@@ -358,256 +620,1639 @@ void generateMazePrim(int startX, int startY) {
                 int newWallX = oppositeX + dX[i];
                 int newWallY = oppositeY + dY[i];
                 if (newWallX > 0 && newWallX < mazeWidth-1 && newWallY > 0 && newWallY < mazeHeight-1 && maze[newWallY][newWallX] == '#') {
-                    frontier.push_back({newWallX, newWallY});
+                    frontier[frontierSize++] = {newWallX, newWallY};
                 }
             }
         }
     }
 }
 
-// --- Pathfinding Function (BFS for Shortest Path) ---
-int calculateShortestPathLength(int startX, int startY, int targetX, int targetY) {
-    if (startX < 0 || startX >= mazeWidth || startY < 0 || startY >= mazeHeight || maze[startY][startX] == '#') return -1;
-    if (targetX < 0 || targetX >= mazeWidth || targetY < 0 || targetY >= mazeHeight || maze[targetY][targetX] == '#') return -1;
-    
-    queue<pair<int, int>> q;
-    vector<vector<int>> dist(mazeHeight, vector<int>(mazeWidth, -1));
-
-    q.push({startX, startY});
-    dist[startY][startX] = 0;
+// --- Work-Stealing Pool ---
+// Fork-join pool for divide-and-conquer generators. Every worker owns a deque: it pushes
+// and pops its own tasks at the back (newest first, still warm in cache), and an idle
+// worker steals from the front of another worker's deque, where the oldest and therefore
+// largest pieces of work sit. The thread that calls Run() is worker 0 and keeps helping
+// until every spawned task has finished, which is the join.
+thread_local int poolWorkerIndex = 0;
+
+struct WorkStealingPool {
+    struct WorkerQueue {
+        mutex lock;
+        deque<function<void()>> tasks;
+    };
 
-    int dX[] = {0, 0, 1, -1};
-    int dY[] = {-1, 1, 0, 0};
+    vector<unique_ptr<WorkerQueue>> queues;
+    atomic<long long> pending{0}; // Spawned tasks that have not finished yet
+    atomic<long long> steals{0};
+
+    // Runs root, and everything it spawns, on 'workers' threads including the caller
+    void Run(int workers, function<void()> root) {
+        workers = max(1, workers);
+        queues.clear();
+        for (int i = 0; i < workers; ++i) queues.emplace_back(new WorkerQueue());
+        steals = 0;
+        poolWorkerIndex = 0;
+        Spawn(move(root));
+
+        vector<thread> threads;
+        threads.reserve(workers - 1);
+        for (int i = 1; i < workers; ++i) {
+            threads.emplace_back([this, i]() {
+                poolWorkerIndex = i;
+                WorkUntilDone(i);
+            });
+        }
+        WorkUntilDone(0);
+        for (thread& worker : threads) worker.join();
+    }
 
-    while (!q.empty()) {
-        pair<int, int> current = q.front();
-        q.pop();
-        int x = current.first;
-        int y = current.second;
+    // Only valid from inside a task (or the root) of the current Run()
+    void Spawn(function<void()> task) {
+        pending.fetch_add(1, memory_order_relaxed);
+        WorkerQueue& queue = *queues[poolWorkerIndex];
+        lock_guard<mutex> guard(queue.lock);
+        queue.tasks.push_back(move(task));
+    }
 
-        if (x == targetX && y == targetY) {
-            return dist[y][x];
+    bool TakeTask(int self, function<void()>& task) {
+        {
+            WorkerQueue& own = *queues[self];
+            lock_guard<mutex> guard(own.lock);
+            if (!own.tasks.empty()) {
+                task = move(own.tasks.back());
+                own.tasks.pop_back();
+                return true;
+            }
         }
+        int workers = (int)queues.size();
+        for (int k = 1; k < workers; ++k) {
+            WorkerQueue& victim = *queues[(self + k) % workers];
+            lock_guard<mutex> guard(victim.lock);
+            if (!victim.tasks.empty()) {
+                task = move(victim.tasks.front());
+                victim.tasks.pop_front();
+                steals.fetch_add(1, memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
 
-        for (int i = 0; i < 4; ++i) {
-            int nx = x + dX[i];
-            int ny = y + dY[i];
-
-            if (nx >= 0 && nx < mazeWidth && ny >= 0 && ny < mazeHeight &&
-                maze[ny][nx] != '#' && dist[ny][nx] == -1) {
-                dist[ny][nx] = dist[y][x] + 1;
-                q.push({nx, ny});
+    void WorkUntilDone(int self) {
+        function<void()> task;
+        while (pending.load(memory_order_acquire) > 0) {
+            if (TakeTask(self, task)) {
+                task();
+                task = nullptr;
+                pending.fetch_sub(1, memory_order_acq_rel); // After task() so its spawns are already counted
+            } else {
+                this_thread::yield();
             }
         }
     }
-    return -1;
+};
+
+WorkStealingPool generationPool;
+
+// Recursive division: start from one open room, split every chamber with a straight wall
+// that has a single gap, and handle the two halves independently. Halves never share a
+// cell, so big chambers become pool tasks that any core can run without locking, and
+// chambers below the cutoff finish in a sequential kernel. Each task chamber draws from its
+// own PCG32 stream keyed by its place in the split tree, so a seed gives the same maze no
+// matter how many threads run it or which worker steals what.
+const long long DIVISION_TASK_CUTOFF = 1 << 15; // Chambers with fewer cells stay on one thread
+
+struct DivisionChamber {
+    int left, top, right, bottom; // Inclusive bounds, all on odd (room) coordinates
+    uint64_t streamId;
+
+    long long Cells() const { return (long long)(right - left + 1) * (bottom - top + 1); }
+};
+
+// Stream id for one half of a split chamber (SplitMix64 finaliser of the parent id)
+inline uint64_t divisionChildStream(uint64_t parentStream, uint64_t half) {
+    uint64_t z = parentStream * 2 + half + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
 }
 
-// Helper function to find a valid ' ' cell for player/exit
-pair<int, int> findValidEmptyCell() {
-    uniform_int_distribution<> dist_x(1, mazeWidth - 2);
-    uniform_int_distribution<> dist_y(1, mazeHeight - 2);
-    int maxAttempts = 1000;
-    for (int attempts = 0; attempts < maxAttempts; ++attempts) {
-        int x = dist_x(rng);
-        int y = dist_y(rng);
-        if (maze[y][x] == ' ') {
-            return {x, y};
+// Draws one wall across the chamber, leaving a one-cell gap. Chambers one room wide or tall
+// are already corridors and are left alone. Returns false when nothing was split.
+bool splitChamber(MazeGrid& grid, const DivisionChamber& chamber, PCG32& gen, DivisionChamber& first, DivisionChamber& second) {
+    int roomsWide = (chamber.right - chamber.left) / 2 + 1;
+    int roomsTall = (chamber.bottom - chamber.top) / 2 + 1;
+    if (roomsWide < 2 || roomsTall < 2) return false;
+
+    // Cut across the longer side; that is what keeps the walls long and straight
+    bool horizontal = roomsTall > roomsWide || (roomsTall == roomsWide && (gen() & 1));
+    first = second = chamber;
+    first.streamId = divisionChildStream(chamber.streamId, 0);
+    second.streamId = divisionChildStream(chamber.streamId, 1);
+    if (horizontal) {
+        int wallY = chamber.top + 1 + 2 * uniform_int_distribution<int>(0, roomsTall - 2)(gen);
+        int gapX = chamber.left + 2 * uniform_int_distribution<int>(0, roomsWide - 1)(gen);
+        char* row = grid[wallY];
+        memset(row + chamber.left, '#', chamber.right - chamber.left + 1);
+        row[gapX] = ' ';
+        first.bottom = wallY - 1;
+        second.top = wallY + 1;
+    } else {
+        int wallX = chamber.left + 1 + 2 * uniform_int_distribution<int>(0, roomsWide - 2)(gen);
+        int gapY = chamber.top + 2 * uniform_int_distribution<int>(0, roomsTall - 1)(gen);
+        for (int y = chamber.top; y <= chamber.bottom; ++y) {
+            if (y != gapY) grid[y][wallX] = '#';
         }
+        first.right = wallX - 1;
+        second.left = wallX + 1;
     }
-    // Fallback if no random empty cell is found (shouldn't happen in a valid maze)
-    return {1, 1}; 
+    return true;
 }
 
-// --- General Game Functions ---
-void setupGame(int levelIdx, EntranceExitStrategy strategy) {
-    currentLevelIndex = levelIdx;
-    
-    // Set maze dimensions based on level
-    switch (levelIdx) {
-        case 0: mazeWidth = 31; mazeHeight = 15; break;      // Easy
-        case 1: mazeWidth = 41; mazeHeight = 21; break;      // Medium
-        case 2: mazeWidth = 51; mazeHeight = 25; break;      // Hard
-        case 3: mazeWidth = 61; mazeHeight = 31; break;      // Very Hard
-        default: mazeWidth = 51; mazeHeight = 25; break; 
+// Both halves of a split go on the stack with the smaller one on top, so every chamber left
+// waiting below is at least as big as the one being split. Each step down the stack then
+// halves the room count, and log2(rooms) + 2 slots hold any grid.
+const int DIVISION_STACK_LIMIT = 66; // Enough for any grid whose cell count fits in 64 bits
+
+int divisionStackSlots(int width, int height) {
+    long long rooms = (long long)max(1, (width - 1) / 2) * max(1, (height - 1) / 2);
+    int slots = 2;
+    while (rooms > 1) {
+        rooms >>= 1;
+        slots++;
     }
-    
-    // Ensure maze dimensions are odd for proper generation with Prim's/DFS/BFS
-    if (mazeWidth % 2 == 0) mazeWidth++;
-    if (mazeHeight % 2 == 0) mazeHeight++;
+    return slots;
+}
 
-    // Dynamically calculate offsets to center the maze
-    mazeOffsetX = (fixedScreenWidth - mazeWidth * TILE_SIZE) / 2;
-    mazeOffsetY = (fixedScreenHeight - mazeHeight * TILE_SIZE - HUD_HEIGHT) / 2 + HUD_HEIGHT;
-    if (mazeOffsetX < 0) mazeOffsetX = 0;
-    if (mazeOffsetY < 0) mazeOffsetY = 0;
-    
-    // ⭐⭐ Generate maze using the appropriate algorithm (EASY/MEDIUM SWAPPED) ⭐⭐
-    switch (levelIdx) {
-        case 0: generateMazeBFS(1, 1); break;   // Now EASY (using the less complex BFS structure)
-        case 1: generateMazeDFS(1, 1); break;   // Now MEDIUM (using the more complex DFS structure)
-        case 2: generateMazeKruskal(); break;
-        case 3: generateMazePrim(1, 1); break;
-        default: generateMazeDFS(1, 1); break;
-    }
-    // ⭐⭐ END SWAP ⭐⭐
+size_t divisionStackBytes(int width, int height) {
+    return divisionStackSlots(width, height) * sizeof(DivisionChamber);
+}
 
-    // --- Player and Exit Placement based on Strategy ---
-    switch (strategy) {
-        case RANDOM_PLACEMENT: {
-            pair<int, int> playerPos = findValidEmptyCell();
-            playerX = playerPos.first;
-            playerY = playerPos.second;
+inline void pushDivisionHalves(DivisionChamber* stack, int& depth, const DivisionChamber& first, const DivisionChamber& second) {
+    bool firstSmaller = first.Cells() <= second.Cells();
+    stack[depth++] = firstSmaller ? second : first;
+    stack[depth++] = firstSmaller ? first : second;
+}
 
-            pair<int, int> exitPos;
-            int maxAttempts = 1000;
-            int attempts = 0;
-            do {
-                exitPos = findValidEmptyCell();
-                attempts++;
-            } while ((exitPos.first == playerX && exitPos.second == playerY) && attempts < maxAttempts);
-            exitX = exitPos.first;
-            exitY = exitPos.second;
-        } break;
+// Sequential kernel: one stream for the whole chamber, with the pending sub-chambers kept on
+// the caller's stack from index 'depth' upwards
+void divideChamberSequential(MazeGrid& grid, const DivisionChamber& root, uint64_t seed, DivisionChamber* stack, int depth = 0) {
+    PCG32 gen(seed, root.streamId);
+    int base = depth;
+    stack[depth++] = root;
+    DivisionChamber first, second;
+    while (depth > base) {
+        DivisionChamber chamber = stack[--depth];
+        if (splitChamber(grid, chamber, gen, first, second)) pushDivisionHalves(stack, depth, first, second);
+    }
+}
 
-        case TOP_LEFT_BOTTOM_RIGHT: {
-            playerX = 1; // Top-left
-            playerY = 1;
-            while(maze[playerY][playerX] == '#') { // Ensure player starts on a path
-                playerX++; 
-                if (playerX >= mazeWidth - 1) { playerX = 1; playerY++; }
-                if (playerY >= mazeHeight - 1) { playerY = 1; break; } // Should not happen in valid maze
-            }
+// Pool task: splits the chamber for as long as it is above the cutoff, spawning one half of
+// every split and keeping the other, then finishes what is left with the sequential kernel.
+// Workers share no arena, so the kernel's stack lives in the task's frame.
+void divideChamberTask(MazeGrid& grid, DivisionChamber chamber, uint64_t seed) {
+    DivisionChamber first, second;
+    while (chamber.Cells() >= DIVISION_TASK_CUTOFF) {
+        PCG32 gen(seed, chamber.streamId);
+        if (!splitChamber(grid, chamber, gen, first, second)) return;
+        generationPool.Spawn([&grid, second, seed]() { divideChamberTask(grid, second, seed); });
+        chamber = first;
+    }
+    DivisionChamber stack[DIVISION_STACK_LIMIT];
+    divideChamberSequential(grid, chamber, seed, stack);
+}
 
-            exitX = mazeWidth - 2; // Bottom-right
-            exitY = mazeHeight - 2;
-            while(maze[exitY][exitX] == '#') { // Ensure exit is on a path
-                exitX--; 
-                if (exitX <= 0) { exitX = mazeWidth - 2; exitY--; }
-                if (exitY <= 0) { exitY = mazeHeight - 2; break; } // Should not happen
-            }
-            // Ensure player and exit are not the same (unlikely but good safeguard)
-            if (playerX == exitX && playerY == exitY) {
-                exitX = mazeWidth - 4; // Shift exit if it overlaps
-                exitY = mazeHeight - 4;
+// Carves a perfect maze into grid. threads == 0 uses every hardware thread; grids below the
+// cutoff never start the pool.
+void generateMazeDivision(MazeGrid& grid, uint64_t seed, int threads = 0) {
+    // Rooms sit on odd coordinates; an even width or height leaves one extra wall line
+    int lastX = grid.width - 2 - (grid.width % 2 == 0);
+    int lastY = grid.height - 2 - (grid.height % 2 == 0);
+    if (lastX < 1 || lastY < 1) return;
+    DivisionChamber root = {1, 1, lastX, lastY, 0};
+    if (threads <= 0) threads = (int)max(1u, thread::hardware_concurrency());
+
+    if (threads == 1 || root.Cells() < DIVISION_TASK_CUTOFF) {
+        // Same splits as the parallel path: big chambers draw a fresh stream per split, and
+        // the sequential kernel runs on top of the same arena stack
+        for (int y = 1; y <= lastY; ++y) memset(grid[y] + 1, ' ', lastX);
+        DivisionChamber* stack = levelArena.Allocate<DivisionChamber>(divisionStackSlots(grid.width, grid.height));
+        int depth = 0;
+        stack[depth++] = root;
+        DivisionChamber first, second;
+        while (depth > 0) {
+            DivisionChamber chamber = stack[--depth];
+            if (chamber.Cells() < DIVISION_TASK_CUTOFF) {
+                divideChamberSequential(grid, chamber, seed, stack, depth);
+                continue;
             }
+            PCG32 gen(seed, chamber.streamId);
+            if (splitChamber(grid, chamber, gen, first, second)) pushDivisionHalves(stack, depth, first, second);
+        }
+        return;
+    }
 
-        } break;
+    // Open the room in row bands first, then split it
+    generationPool.Run(threads, [&grid, lastX, lastY]() {
+        const int bandRows = 64;
+        for (int y0 = 1; y0 <= lastY; y0 += bandRows) {
+            generationPool.Spawn([&grid, lastX, lastY, y0]() {
+                for (int y = y0; y <= min(lastY, y0 + bandRows - 1); ++y) memset(grid[y] + 1, ' ', lastX);
+            });
+        }
+    });
+    generationPool.Run(threads, [&grid, root, seed]() { divideChamberTask(grid, root, seed); });
+}
 
-        case LEFT_RIGHT_CENTER: {
-            // Find a valid spot on the left edge (y-coordinate in the middle-ish)
-            playerX = 1;
-            playerY = mazeHeight / 2;
-            while (maze[playerY][playerX] == '#') {
-                playerY++;
-                if (playerY >= mazeHeight - 1) playerY = 1; // Wrap around if needed
-            }
+// --- Out-of-Core Tiled Storage ---
+// A width x height grid kept in a scratch file and paged through a fixed number of cached
+// 256x256 tiles, for stress mazes that do not fit in memory. Tiles that were never written
+// read back as fillValue, so a fresh grid costs no disk space until it is touched.
+const int OOC_TILE_SHIFT = 8;
+const int OOC_TILE_DIM = 1 << OOC_TILE_SHIFT;
+const size_t OOC_TILE_CELLS = (size_t)OOC_TILE_DIM * OOC_TILE_DIM;
+
+inline int seekScratchFile(FILE* file, int64_t offset) {
+#ifdef _WIN32
+    return _fseeki64(file, offset, SEEK_SET);
+#else
+    return fseeko(file, (off_t)offset, SEEK_SET);
+#endif
+}
 
-            // Find a valid spot on the right edge (y-coordinate in the middle-ish)
-            exitX = mazeWidth - 2;
-            exitY = mazeHeight / 2;
-            while (maze[exitY][exitX] == '#') {
-                exitY++;
-                if (exitY >= mazeHeight - 1) exitY = 1; // Wrap around if needed
-            }
-            // Ensure player and exit are not the same
-            if (playerX == exitX && playerY == exitY) {
-                exitX = mazeWidth - 4; // Shift exit if it overlaps
-            }
+template <typename T>
+struct TiledGridStore {
+    struct CacheSlot {
+        int64_t tile = -1;
+        bool dirty = false;
+        uint64_t lastUse = 0;
+    };
 
-        } break;
+    int width = 0;
+    int height = 0;
+    int64_t tilesX = 0;
+    T fillValue;
+    string path;
+    FILE* file = nullptr;
+
+    vector<T> slotData;          // cacheTiles * OOC_TILE_CELLS values
+    vector<CacheSlot> slots;
+    vector<int32_t> slotOfTile;  // -1 when the tile is not cached
+    vector<bool> tileOnDisk;
+    uint64_t useClock = 0;
+    int64_t lastTile = -1;
+    int lastSlot = -1;
+    bool ioFailed = false;       // A seek, read or write on the scratch file came up short
+
+    // Instrumentation
+    uint64_t cacheHits = 0;
+    uint64_t cacheMisses = 0;
+    uint64_t bytesRead = 0;
+    uint64_t bytesWritten = 0;
+
+    TiledGridStore(const char* scratchPath, int w, int h, T fill, size_t cacheTiles)
+        : width(w), height(h), fillValue(fill), path(scratchPath) {
+        tilesX = (w + OOC_TILE_DIM - 1) >> OOC_TILE_SHIFT;
+        int64_t tilesY = (h + OOC_TILE_DIM - 1) >> OOC_TILE_SHIFT;
+        slotOfTile.assign(tilesX * tilesY, -1);
+        tileOnDisk.assign(tilesX * tilesY, false);
+        slots.resize(max<size_t>(cacheTiles, 1));
+        slotData.resize(slots.size() * OOC_TILE_CELLS);
+        file = fopen(scratchPath, "w+b");
+        if (!file) {
+            TraceLog(LOG_ERROR, "OOC: Could not create scratch file %s", scratchPath);
+        }
     }
-    
-    maze[exitY][exitX] = 'E';
 
-    idealMoves = calculateShortestPathLength(playerX, playerY, exitX, exitY);
-    if (idealMoves == -1) {
-        TraceLog(LOG_WARNING, "No path found in generated maze!");
-        idealMoves = 0;
+    ~TiledGridStore() {
+        if (file) {
+            fclose(file);
+            remove(path.c_str());
+        }
     }
 
-    // 1. Player Render Position Initialize for Smooth Movement
-    playerRenderX = (float)playerX;
-    playerRenderY = (float)playerY;
+    // False once the scratch file is missing or any tile I/O has failed; the grid contents
+    // can no longer be trusted after that.
+    bool IsValid() const { return file != nullptr && !ioFailed; }
 
-    // 2. Pulse Timer Initialize
-    pulseTimer = 0.0f;
+    T Get(int x, int y) {
+        return TileFor(x, y, false)[LocalIndex(x, y)];
+    }
 
-    // 3. Reset Game Stats
-    totalTime = 0.0f;
-    totalMoves = 0;
+    void Set(int x, int y, T value) {
+        TileFor(x, y, true)[LocalIndex(x, y)] = value;
+    }
 
-}
+    double HitRate() const {
+        uint64_t total = cacheHits + cacheMisses;
+        return total ? (double)cacheHits / total : 1.0;
+    }
 
-void drawMaze() {
-    for (int i = 0; i < mazeHeight; ++i) {
-        for (int j = 0; j < mazeWidth; ++j) {
-            Rectangle tile = { (float)(j * TILE_SIZE + mazeOffsetX), (float)(i * TILE_SIZE + mazeOffsetY), (float)TILE_SIZE, (float)TILE_SIZE };
-            
-            if (maze[i][j] == '#') {
-                // Draw a darker base for the brick
-                DrawRectangleRec(tile, GetColor(0x4A4A4AFF)); // Darker gray for the main brick body
-                // Draw a lighter highlight for a simple 3D effect
-                DrawRectangle(tile.x, tile.y, TILE_SIZE, 2, GetColor(0x606060FF)); // Top edge highlight
-                DrawRectangle(tile.x, tile.y, 2, TILE_SIZE, GetColor(0x606060FF)); // Left edge highlight
-                } 
-            //     else if (maze[i][j] == 'E') {
-            //     // ⭐ Exit Sign Pulsing Logic
-            //     float pulseFactor = sin(pulseTimer) * 0.5f + 0.5f; // Goes from 0.0 (dim) to 1.0 (bright)
-
-            //     // Blend between LIME (base color) and WHITE (highlight color)
-            //     Color baseColor = LIME;
-                
-            //     // ম্যানুয়ালি কালার ব্লেন্ড করা
-            //     Color finalColor;
-            //     finalColor.r = (unsigned char)(baseColor.r * (1.0f - pulseFactor) + WHITE.r * pulseFactor);
-            //     finalColor.g = (unsigned char)(baseColor.g * (1.0f - pulseFactor) + WHITE.g * pulseFactor);
-            //     finalColor.b = (unsigned char)(baseColor.b * (1.0f - pulseFactor) + WHITE.b * pulseFactor);
-            //     finalColor.a = 255;
-                
-            //     Vector2 triA = { tile.x + TILE_SIZE / 2, tile.y + TILE_SIZE / 4 };
-            //     Vector2 triB = { tile.x + TILE_SIZE / 4, tile.y + TILE_SIZE - TILE_SIZE / 4 };
-            //     Vector2 triC = { tile.x + TILE_SIZE - TILE_SIZE / 4, tile.y + TILE_SIZE - TILE_SIZE / 4 };
-            //     DrawTriangle(triA, triB, triC, finalColor); // ⭐ finalColor ব্যবহার করা হয়েছে
-            // }
-
-            else if (maze[i][j] == 'E') {
-            // ⭐⭐ Color and Brightness Pulsing Logic (Using HSV) ⭐⭐
-            
-            float pulseFactor = sin(pulseTimer) * 0.5f + 0.5f; // Goes from 0.0 (dim) to 1.0 (bright)
+    static size_t LocalIndex(int x, int y) {
+        return ((size_t)(y & (OOC_TILE_DIM - 1)) << OOC_TILE_SHIFT) | (size_t)(x & (OOC_TILE_DIM - 1));
+    }
 
-            // 1. Hue Shifting: Time-based color change (from Green to Yellow/Cyan)
-            // pulseTimer ব্যবহার করে Hue পরিবর্তন করা হচ্ছে
-            float hue = 120.0f + sin(pulseTimer * 0.5f) * 60.0f; // 120 (Green) থেকে 60 (Yellow) পর্যন্ত
-            
-            // 2. Value Pulsing: Brightness change
-            float value = 0.8f + pulseFactor * 0.2f; // 80% থেকে 100% উজ্জ্বলতা
+    int64_t TileIndex(int x, int y) const {
+        return (int64_t)(y >> OOC_TILE_SHIFT) * tilesX + (x >> OOC_TILE_SHIFT);
+    }
 
-            // HSV থেকে Color এ রূপান্তর
-            Color finalColor = ColorFromHSV(hue, 1.0f, value);
-            
-            // Draw the Exit Triangle
-            Vector2 tile = { (float)(j * TILE_SIZE + mazeOffsetX), (float)(i * TILE_SIZE + mazeOffsetY) };
-            
-            Vector2 triA = { tile.x + TILE_SIZE / 2, tile.y + TILE_SIZE / 4 };
-            Vector2 triB = { tile.x + TILE_SIZE / 4, tile.y + TILE_SIZE - TILE_SIZE / 4 };
-            Vector2 triC = { tile.x + TILE_SIZE - TILE_SIZE / 4, tile.y + TILE_SIZE - TILE_SIZE / 4 };
-            
-            DrawTriangle(triA, triB, triC, finalColor); 
+    T* TileFor(int x, int y, bool forWrite) {
+        int64_t tile = TileIndex(x, y);
+        int slot = lastSlot;
+        if (tile != lastTile) {
+            slot = slotOfTile[tile];
+            if (slot < 0) {
+                ++cacheMisses;
+                slot = LoadTile(tile);
+            } else {
+                ++cacheHits;
+            }
+            lastTile = tile;
+            lastSlot = slot;
+        } else {
+            ++cacheHits;
         }
+        slots[slot].lastUse = ++useClock;
+        if (forWrite) slots[slot].dirty = true;
+        return &slotData[(size_t)slot * OOC_TILE_CELLS];
+    }
 
+    // Evicts the least recently used slot and pages the requested tile into it
+    int LoadTile(int64_t tile) {
+        int victim = 0;
+        for (int i = 1; i < (int)slots.size(); ++i) {
+            if (slots[i].lastUse < slots[victim].lastUse) victim = i;
+        }
+        T* data = &slotData[(size_t)victim * OOC_TILE_CELLS];
+        WriteBack(victim);
+        if (slots[victim].tile >= 0) slotOfTile[slots[victim].tile] = -1;
+
+        size_t got = 0;
+        if (tileOnDisk[tile] && file) {
+            if (seekScratchFile(file, tile * (int64_t)(OOC_TILE_CELLS * sizeof(T))) == 0) {
+                got = fread(data, sizeof(T), OOC_TILE_CELLS, file);
+            }
+            bytesRead += got * sizeof(T);
+            if (got != OOC_TILE_CELLS) ReportIoFailure("read", tile);
+        }
+        if (got != OOC_TILE_CELLS) {
+            // Never hand out the evicted tile's cells as if they belonged to this one
+            fill(data, data + OOC_TILE_CELLS, fillValue);
         }
+        slots[victim].tile = tile;
+        slots[victim].dirty = false;
+        slotOfTile[tile] = victim;
+        return victim;
     }
-}
 
-void handleGameplayInput() {
-    int oldX = playerX;
-    int oldY = playerY;
+    void WriteBack(int slot) {
+        CacheSlot& cached = slots[slot];
+        if (cached.tile < 0 || !cached.dirty || !file) return;
+        size_t put = 0;
+        if (seekScratchFile(file, cached.tile * (int64_t)(OOC_TILE_CELLS * sizeof(T))) == 0) {
+            put = fwrite(&slotData[(size_t)slot * OOC_TILE_CELLS], sizeof(T), OOC_TILE_CELLS, file);
+        }
+        bytesWritten += put * sizeof(T);
+        if (put != OOC_TILE_CELLS) ReportIoFailure("write", cached.tile);
+        tileOnDisk[cached.tile] = true;
+        cached.dirty = false;
+    }
 
-    if (IsKeyPressed(KEY_W) || IsKeyPressed(KEY_UP)) playerY--;
-    else if (IsKeyPressed(KEY_S) || IsKeyPressed(KEY_DOWN)) playerY++;
-    else if (IsKeyPressed(KEY_A) || IsKeyPressed(KEY_LEFT)) playerX--;
-    else if (IsKeyPressed(KEY_D) || IsKeyPressed(KEY_RIGHT)) playerX++;
+    void ReportIoFailure(const char* operation, int64_t tile) {
+        if (!ioFailed) {
+            TraceLog(LOG_ERROR, "OOC: Tile %lld %s failed on %s, grid contents are no longer reliable", (long long)tile, operation, path.c_str());
+        }
+        ioFailed = true;
+    }
+
+    void Flush() {
+        for (int i = 0; i < (int)slots.size(); ++i) WriteBack(i);
+        if (file && fflush(file) != 0) ReportIoFailure("flush", -1);
+    }
+};
+
+// Sidewinder generation. Unlike the four level generators it keeps no per-cell side
+// structures (no stack, queue, frontier or union-find), so it can fill a grid that only exists
+// on disk. The grid must start as all walls ('#'). Runs are also closed at every strip edge,
+// which lets it sweep one tile-wide vertical strip at a time so only two tiles need to stay
+// cached. Grid is anything with Set(x, y, c): MazeGrid or TiledGridStore.
+template <typename Grid, typename RNG>
+void generateMazeSidewinder(Grid& grid, int width, int height, RNG& gen, int stripWidth = OOC_TILE_DIM) {
+    bernoulli_distribution closeRun(0.5);
+    for (int stripStart = 0; stripStart < width; stripStart += stripWidth) {
+        int stripEnd = min(stripStart + stripWidth, width - 1);
+        int firstCell = stripStart | 1;
+        for (int y = 1; y < height - 1; y += 2) {
+            int runStart = firstCell;
+            for (int x = firstCell; x < stripEnd; x += 2) {
+                grid.Set(x, y, ' ');
+                bool lastInRow = (x + 2 >= width - 1);
+                bool lastInStrip = (x + 2 >= stripEnd);
+                if (y == 1) {
+                    // The top row has nothing above it, so it is one long corridor
+                    if (!lastInRow) grid.Set(x + 1, y, ' ');
+                } else if (lastInStrip || closeRun(gen)) {
+                    // Close the run by opening north from one of its cells
+                    uniform_int_distribution<int> pick(0, (x - runStart) / 2);
+                    grid.Set(runStart + pick(gen) * 2, y - 1, ' ');
+                    runStart = x + 2;
+                } else {
+                    grid.Set(x + 1, y, ' ');
+                }
+            }
+        }
+    }
+}
+
+struct ExternalBfsResult {
+    int64_t distance = -1;     // -1 when the target is not reachable
+    int64_t reachedCells = 0;
+    int64_t levels = 0;
+    int64_t peakFrontierTiles = 0; // Most distinct tiles one BFS level's frontier occupied
+};
+
+// Level-synchronous BFS over a tiled grid. Cells are encoded tile-major (tile * tile cells +
+// local offset), so sorting each frontier groups its cells by tile and the expansion streams
+// through the frontier one tile at a time instead of hopping around the cache.
+//
+// Cache sizing: one level touches every tile its frontier occupies, plus the odd neighbour
+// tile across a tile edge, in both the maze and the visited store. Each store therefore needs
+// at least peakFrontierTiles + OOC_BFS_CACHE_MARGIN cache tiles. Below that, every level pages
+// its whole working set back in (2001x2001 with 8 tiles: ~2 GB read for a 4 MB grid; with 16
+// tiles: 4 MB). The frontier itself stays in RAM at 8 bytes per frontier cell, which is tiny
+// next to the grid for mazes, whose frontiers are thin.
+const int64_t OOC_BFS_CACHE_MARGIN = 4;
+
+ExternalBfsResult solveMazeExternalBFS(TiledGridStore<char>& grid, TiledGridStore<uint8_t>& visited,
+                                       int startX, int startY, int targetX, int targetY) {
+    ExternalBfsResult result;
+    if (grid.Get(startX, startY) == '#' || grid.Get(targetX, targetY) == '#') return result;
+
+    auto encode = [&](int x, int y) { return grid.TileIndex(x, y) * (int64_t)OOC_TILE_CELLS + (int64_t)TiledGridStore<char>::LocalIndex(x, y); };
+    vector<int64_t> frontier, next;
+    frontier.push_back(encode(startX, startY));
+    visited.Set(startX, startY, 1);
+    result.reachedCells = 1;
+
+    const int dX[] = {0, 0, 1, -1};
+    const int dY[] = {-1, 1, 0, 0};
+
+    for (int64_t level = 0; !frontier.empty(); ++level) {
+        sort(frontier.begin(), frontier.end());
+        int64_t frontierTiles = 0;
+        for (size_t i = 0; i < frontier.size(); ++i) {
+            if (i == 0 || frontier[i] / (int64_t)OOC_TILE_CELLS != frontier[i - 1] / (int64_t)OOC_TILE_CELLS) ++frontierTiles;
+        }
+        result.peakFrontierTiles = max(result.peakFrontierTiles, frontierTiles);
+        next.clear();
+        for (int64_t code : frontier) {
+            int64_t tile = code / (int64_t)OOC_TILE_CELLS;
+            int local = (int)(code % (int64_t)OOC_TILE_CELLS);
+            int x = (int)((tile % grid.tilesX) << OOC_TILE_SHIFT) + (local & (OOC_TILE_DIM - 1));
+            int y = (int)((tile / grid.tilesX) << OOC_TILE_SHIFT) + (local >> OOC_TILE_SHIFT);
+            if (x == targetX && y == targetY) {
+                result.distance = level;
+                result.levels = level + 1;
+                return result;
+            }
+            for (int i = 0; i < 4; ++i) {
+                int nx = x + dX[i];
+                int ny = y + dY[i];
+                if (nx < 0 || nx >= grid.width || ny < 0 || ny >= grid.height) continue;
+                if (grid.Get(nx, ny) == '#' || visited.Get(nx, ny)) continue;
+                visited.Set(nx, ny, 1);
+                next.push_back(encode(nx, ny));
+                ++result.reachedCells;
+            }
+        }
+        frontier.swap(next);
+        result.levels = level + 1;
+    }
+    return result;
+}
+
+// --- Pathfinding Function (BFS for Shortest Path) ---
+int calculateShortestPathLength(int startX, int startY, int targetX, int targetY) {
+    if (startX < 0 || startX >= mazeWidth || startY < 0 || startY >= mazeHeight || maze[startY][startX] == '#') return -1;
+    if (targetX < 0 || targetX >= mazeWidth || targetY < 0 || targetY >= mazeHeight || maze[targetY][targetX] == '#') return -1;
+    
+    // Distance grid and FIFO queue of cell indices, both drawn from the level arena
+    size_t cellCount = (size_t)mazeWidth * mazeHeight;
+    int* dist = levelArena.Allocate<int>(cellCount);
+    int* q = levelArena.Allocate<int>(cellCount);
+    fill(dist, dist + cellCount, -1);
+    size_t head = 0, tail = 0;
+
+    q[tail++] = startY * mazeWidth + startX;
+    dist[startY * mazeWidth + startX] = 0;
+
+    int dX[] = {0, 0, 1, -1};
+    int dY[] = {-1, 1, 0, 0};
+
+    while (head < tail) {
+        int current = q[head++];
+        int x = current % mazeWidth;
+        int y = current / mazeWidth;
+
+        if (x == targetX && y == targetY) {
+            return dist[current];
+        }
+
+        for (int i = 0; i < 4; ++i) {
+            int nx = x + dX[i];
+            int ny = y + dY[i];
+            int next = ny * mazeWidth + nx;
+
+            if (nx >= 0 && nx < mazeWidth && ny >= 0 && ny < mazeHeight &&
+                maze[ny][nx] != '#' && dist[next] == -1) {
+                dist[next] = dist[current] + 1;
+                q[tail++] = next;
+            }
+        }
+    }
+    return -1;
+}
+
+// --- Perfect Maze Validator ---
+// A maze is perfect when its open cells form a tree: one connected component and no
+// cycles. One union-find pass over the open cells answers both at once, since every
+// passage (pair of adjacent open cells) either merges two components or closes a cycle.
+// Bands of rows are unioned in parallel, then the band seams are stitched together.
+struct MazeValidation {
+    bool borderClosed = false;
+    bool endpointsOpen = false;
+    bool connected = false;
+    bool acyclic = false;
+    long long openCells = 0;
+    long long passages = 0;
+    long long components = 0;
+
+    bool IsPerfect() const { return borderClosed && endpointsOpen && connected && acyclic; }
+};
+
+struct MazeValidator {
+    static constexpr long long PARALLEL_MIN_CELLS = 1 << 20; // Smaller grids finish before a thread starts
+    static constexpr int MAX_BANDS = 64;
+
+    // Inline popcount: without -mpopcnt the builtin becomes a library call per word.
+    static int CountBits(uint64_t bits) {
+        bits = bits - ((bits >> 1) & 0x5555555555555555ULL);
+        bits = (bits & 0x3333333333333333ULL) + ((bits >> 2) & 0x3333333333333333ULL);
+        bits = (bits + (bits >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+        return (int)((bits * 0x0101010101010101ULL) >> 56);
+    }
+
+    // Union-find over horizontal runs of open cells rather than single cells. Each row is
+    // packed into 64-bit words (bit x of word x / 64 is cell x): popcounts give the open
+    // cells and runs, cells inside a run are joined for free, and only the vertical passages
+    // (open bits shared with the row above) go through Find/Union.
+    struct RowBits {
+        uint64_t* open;   // Open cells
+        uint64_t* starts; // First cell of each run
+        int firstRun;     // Id of the row's leftmost run
+    };
+
+    int width = 0;
+    int words = 0;
+    vector<int> parent;
+    vector<uint64_t> rowStore; // Per band: two rolling rows plus copies of its first and last row
+    vector<int> bandStart;
+
+    int Find(int run) {
+        while (parent[run] != run) {
+            parent[run] = parent[parent[run]]; // Path halving
+            run = parent[run];
+        }
+        return run;
+    }
+
+    bool Union(int a, int b) {
+        a = Find(a);
+        b = Find(b);
+        if (a == b) return false;
+        if (a < b) parent[b] = a; else parent[a] = b;
+        return true;
+    }
+
+    struct BandCounts {
+        long long openCells = 0;
+        long long passages = 0;
+        long long merges = 0;
+        bool borderClosed = true;
+    };
+
+    RowBits BandRow(int band, int slot, int firstRun = 0) {
+        uint64_t* base = rowStore.data() + ((size_t)band * 4 + slot) * 2 * words;
+        return RowBits{base, base + words, firstRun};
+    }
+
+    void CopyRow(const RowBits& from, int band, int slot) {
+        memcpy(BandRow(band, slot).open, from.open, 2 * words * sizeof(uint64_t));
+    }
+
+    // Eight cells at once: bit i is set when byte i is not '#'.
+    static uint64_t OpenByteMask(const char* cells) {
+        uint64_t bytes;
+        memcpy(&bytes, cells, sizeof(bytes));
+        uint64_t diff = bytes ^ 0x2323232323232323ULL; // Zero bytes are walls
+        uint64_t nonZero = (((diff & 0x7f7f7f7f7f7f7f7fULL) + 0x7f7f7f7f7f7f7f7fULL) | diff) & 0x8080808080808080ULL;
+        return ((nonZero >> 7) * 0x0102040810204080ULL) >> 56;
+    }
+
+    // Packs one maze row and numbers its runs starting at firstRun. Returns the run count.
+    int PackRow(const char* cells, RowBits& row, int firstRun) {
+        int runs = 0;
+        uint64_t carry = 0; // Open bit of the previous word's last cell
+        for (int w = 0; w < words; ++w) {
+            int x0 = w * 64;
+            int count = min(64, width - x0);
+            uint64_t bits = 0;
+            int b = 0;
+            for (; b + 8 <= count; b += 8) bits |= OpenByteMask(cells + x0 + b) << b;
+            for (; b < count; ++b) bits |= (uint64_t)(cells[x0 + b] != '#') << b;
+            row.open[w] = bits;
+            row.starts[w] = bits & ~((bits << 1) | carry);
+            runs += CountBits(row.starts[w]);
+            carry = bits >> 63;
+        }
+        row.firstRun = firstRun;
+        for (int r = firstRun; r < firstRun + runs; ++r) parent[r] = r;
+        return runs;
+    }
+
+    // Joins every vertical passage between two packed rows. Returns the number of passages.
+    long long LinkRows(const RowBits& above, const RowBits& below, long long& merges) {
+        long long passages = 0;
+        int aboveRun = above.firstRun - 1, belowRun = below.firstRun - 1;
+        for (int w = 0; w < words; ++w) {
+            uint64_t shared = above.open[w] & below.open[w];
+            uint64_t aboveStarts = above.starts[w], belowStarts = below.starts[w];
+            while (shared) {
+                // Walk the run starts up to this passage instead of counting bits per lookup
+                uint64_t upTo = shared ^ (shared - 1);
+                shared &= shared - 1;
+                for (; aboveStarts & upTo; aboveStarts &= aboveStarts - 1) aboveRun++;
+                for (; belowStarts & upTo; belowStarts &= belowStarts - 1) belowRun++;
+                passages++;
+                if (Union(aboveRun, belowRun)) merges++;
+            }
+            aboveRun += CountBits(aboveStarts);
+            belowRun += CountBits(belowStarts);
+        }
+        return passages;
+    }
+
+    // Labels rows [y0, y1) using only links that stay inside the band. Each band numbers its
+    // runs from its own range of ids, so bands never touch each other's parent entries.
+    void ScanBand(const MazeGrid& grid, int band, int y0, int y1, BandCounts& counts) {
+        int runsPerRow = (width + 1) / 2;
+        RowBits prev = BandRow(band, 0);
+        RowBits cur = BandRow(band, 1);
+        for (int y = y0; y < y1; ++y) {
+            int runs = PackRow(grid[y], cur, y * runsPerRow);
+            long long open = 0;
+            for (int w = 0; w < words; ++w) open += CountBits(cur.open[w]);
+            counts.openCells += open;
+            counts.passages += open - runs; // Passages inside runs are always tree edges
+            counts.merges += open - runs;
+
+            bool borderRow = (y == 0 || y == grid.height - 1);
+            bool leftOpen = cur.open[0] & 1;
+            bool rightOpen = (cur.open[(width - 1) >> 6] >> ((width - 1) & 63)) & 1;
+            if ((borderRow && open > 0) || leftOpen || rightOpen) counts.borderClosed = false;
+
+            if (y > y0) counts.passages += LinkRows(prev, cur, counts.merges);
+            if (y == y0) CopyRow(cur, band, 2);
+            swap(prev, cur);
+        }
+        CopyRow(prev, band, 3);
+    }
+
+    // threads == 0 picks a count from the grid size and the hardware.
+    MazeValidation Validate(const MazeGrid& grid, int startX, int startY, int exitX, int exitY, int threads = 0) {
+        MazeValidation result;
+        width = grid.width;
+        int height = grid.height;
+        long long cells = (long long)width * height;
+        if (cells <= 0) return result;
+        words = (width + 63) / 64;
+
+        if (threads <= 0) {
+            threads = cells < PARALLEL_MIN_CELLS ? 1 : (int)max(1u, thread::hardware_concurrency());
+        }
+        threads = max(1, min(min(threads, height), MAX_BANDS));
+
+        size_t runCapacity = (size_t)height * ((width + 1) / 2);
+        if (parent.size() < runCapacity) parent.resize(runCapacity);
+        if (rowStore.size() < (size_t)threads * 4 * 2 * words) rowStore.resize((size_t)threads * 4 * 2 * words);
+        bandStart.resize(threads + 1);
+        for (int b = 0; b <= threads; ++b) bandStart[b] = (int)((long long)height * b / threads);
+
+        BandCounts bands[MAX_BANDS];
+        if (threads == 1) {
+            ScanBand(grid, 0, 0, height, bands[0]);
+        } else {
+            vector<thread> workers;
+            workers.reserve(threads - 1);
+            for (int b = 1; b < threads; ++b) {
+                workers.emplace_back([this, &grid, &bands, b]() { ScanBand(grid, b, bandStart[b], bandStart[b + 1], bands[b]); });
+            }
+            ScanBand(grid, 0, bandStart[0], bandStart[1], bands[0]);
+            for (thread& worker : workers) worker.join();
+        }
+
+        long long merges = 0;
+        result.borderClosed = true;
+        for (int b = 0; b < threads; ++b) {
+            const BandCounts& band = bands[b];
+            result.openCells += band.openCells;
+            result.passages += band.passages;
+            merges += band.merges;
+            result.borderClosed = result.borderClosed && band.borderClosed;
+        }
+
+        // Stitch each band's first row to the last row of the band above it
+        int runsPerRow = (width + 1) / 2;
+        for (int b = 1; b < threads; ++b) {
+            int y = bandStart[b];
+            result.passages += LinkRows(BandRow(b - 1, 3, (y - 1) * runsPerRow), BandRow(b, 2, y * runsPerRow), merges);
+        }
+
+        result.components = result.openCells - merges;
+        result.connected = (result.components == 1);
+        result.acyclic = (result.passages == merges);
+
+        auto isOpen = [&](int x, int y) { return x >= 0 && x < width && y >= 0 && y < height && grid[y][x] != '#'; };
+        result.endpointsOpen = isOpen(startX, startY) && isOpen(exitX, exitY) && !(startX == exitX && startY == exitY);
+        return result;
+    }
+};
+
+MazeValidator levelValidator;
+
+// --- Bit-Parallel BFS ---
+// Keeps the open cells, the visited set and the frontier as packed bit rows (bit x of word
+// x / 64 is cell x). One BFS level is a handful of shifts, ORs and ANDs per 64-bit word:
+// a cell joins the next frontier when it is open, unvisited and has a frontier neighbour
+// left, right, above or below, so a single word op advances up to 64 cells at once.
+// Each row has one zero padding word on both sides and there are two zero padding rows above
+// and below the maze. A frontier on the maze's first or last row makes the padding row next
+// to it a candidate, and expanding that word reads one row further out; the second padding
+// row keeps that read in bounds, so the neighbour loads never need bounds checks.
+//
+// Maze frontiers are thin, so a level does not sweep the whole grid: it only expands the
+// words that hold frontier cells and their four neighbouring words.
+struct BitParallelBFS {
+    int width = 0;
+    int height = 0;
+    int words = 0;   // 64-bit words of real cells per row
+    int stride = 0;  // words + 2 padding words
+    vector<uint64_t> open, visited, frontier, next;
+    vector<uint32_t> activeWords, candidateWords; // Word indices into the padded arrays
+    vector<uint32_t> wordStamp;
+    uint32_t stamp = 0;
+    int distance = -1;  // Steps from start to target, -1 when unreachable
+    int levels = 0;
+
+    size_t WordIndex(int x, int y) const { return (size_t)(y + 2) * stride + 1 + (x >> 6); }
+
+    void Load(const MazeGrid& grid) {
+        width = grid.width;
+        height = grid.height;
+        words = (width + 63) / 64;
+        stride = words + 2;
+        size_t total = (size_t)stride * (height + 4);
+        open.assign(total, 0);
+        visited.assign(total, 0);
+        frontier.assign(total, 0);
+        next.assign(total, 0);
+        wordStamp.assign(total, 0);
+        stamp = 0;
+        activeWords.reserve(total);
+        candidateWords.reserve(total);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                if (grid.Get(x, y) != '#') open[WordIndex(x, y)] |= 1ULL << (x & 63);
+            }
+        }
+    }
+
+    bool IsReachable(int x, int y) const {
+        return (visited[WordIndex(x, y)] >> (x & 63)) & 1;
+    }
+
+    void AddCandidate(uint32_t w) {
+        if (wordStamp[w] != stamp) {
+            wordStamp[w] = stamp;
+            candidateWords.push_back(w);
+        }
+    }
+
+    // Runs the BFS to completion, so afterwards IsReachable() answers for every cell, unless
+    // stopAtTarget is set. Returns the start-to-target distance (-1 if unreachable, outside
+    // the grid or either end is a wall; nothing is marked reachable in those cases).
+    int Solve(int startX, int startY, int targetX, int targetY, bool stopAtTarget = false) {
+        fill(visited.begin(), visited.end(), 0);
+        distance = -1;
+        levels = 0;
+        activeWords.clear();
+        if (startX < 0 || startX >= width || startY < 0 || startY >= height) return -1;
+        if (targetX < 0 || targetX >= width || targetY < 0 || targetY >= height) return -1;
+        size_t startWord = WordIndex(startX, startY);
+        size_t targetWord = WordIndex(targetX, targetY);
+        uint64_t targetBit = 1ULL << (targetX & 63);
+        if (!((open[startWord] >> (startX & 63)) & 1)) return -1;
+        if (!(open[targetWord] & targetBit)) return -1;
+
+        frontier[startWord] = 1ULL << (startX & 63);
+        visited[startWord] = frontier[startWord];
+        activeWords.push_back((uint32_t)startWord);
+
+        const uint64_t* o = open.data();
+        while (!activeWords.empty()) {
+            if (distance < 0 && (frontier[targetWord] & targetBit)) {
+                distance = levels;
+                if (stopAtTarget) break;
+            }
+
+            // Words that can gain cells: each frontier word and its left, right, up and down
+            // neighbours. Padding words are never open, so they can be expanded harmlessly.
+            if (++stamp == 0) {
+                fill(wordStamp.begin(), wordStamp.end(), 0);
+                stamp = 1;
+            }
+            candidateWords.clear();
+            for (uint32_t w : activeWords) {
+                AddCandidate(w);
+                AddCandidate(w - 1);
+                AddCandidate(w + 1);
+                AddCandidate(w - stride);
+                AddCandidate(w + stride);
+            }
+
+            const uint64_t* f = frontier.data();
+            uint64_t* vis = visited.data();
+            uint64_t* n = next.data();
+            size_t newActive = 0;
+            for (uint32_t w : candidateWords) {
+                uint64_t spread = (f[w] << 1) | (f[w - 1] >> 63) | (f[w] >> 1) | (f[w + 1] << 63) | f[w - stride] | f[w + stride];
+                uint64_t reached = spread & o[w] & ~vis[w];
+                if (reached) {
+                    n[w] = reached;
+                    vis[w] |= reached;
+                    candidateWords[newActive++] = w;
+                }
+            }
+            for (uint32_t w : activeWords) frontier[w] = 0;
+            candidateWords.resize(newActive);
+            activeWords.swap(candidateWords);
+            frontier.swap(next);
+            ++levels;
+        }
+        for (uint32_t w : activeWords) frontier[w] = 0; // Leave the frontier clean after an early stop
+        return distance;
+    }
+};
+
+// --- Incremental Distance Field ---
+// Distance from every open cell to one source cell (the exit), kept up to date while the
+// maze is edited instead of re-running a full BFS per toggle:
+//  - Opening a wall only lowers distances, so the new cell takes its best neighbour + 1 and
+//    the improvement is relaxed outward until it stops helping.
+//  - Closing a cell only invalidates the cells whose every shortest path went through it.
+//    That region is found by walking down the distance gradient, cleared, and re-filled from
+//    its boundary with the rest of the maze. Anything that gets no boundary value is cut off.
+// The work per edit is proportional to the region whose distances actually change.
+const int UNREACHABLE = INT_MAX;
+
+// Unit-weight BFS over the open cells of grid from one source cell. Every cell gets its
+// step count in dist, or UNREACHABLE. queue needs one slot per cell; afterwards its first
+// entries are the reached cells in BFS order. Returns how many cells were reached. Both
+// buffers are caller-owned, so the editor's distance field and the chase flow field share
+// this one BFS over their own arena blocks.
+int fillDistancesFrom(const MazeGrid& grid, int sourceIndex, int* dist, int* queue) {
+    int width = grid.width, height = grid.height;
+    fill(dist, dist + (size_t)width * height, UNREACHABLE);
+    size_t head = 0, tail = 0;
+    dist[sourceIndex] = 0;
+    queue[tail++] = sourceIndex;
+    while (head < tail) {
+        int u = queue[head++];
+        int x = u % width, y = u / width;
+        int nbrs[4], count = 0;
+        if (y > 0) nbrs[count++] = u - width;
+        if (y < height - 1) nbrs[count++] = u + width;
+        if (x < width - 1) nbrs[count++] = u + 1;
+        if (x > 0) nbrs[count++] = u - 1;
+        for (int k = 0; k < count; ++k) {
+            int v = nbrs[k];
+            if (grid.cells[v] != '#' && dist[v] == UNREACHABLE) {
+                dist[v] = dist[u] + 1;
+                queue[tail++] = v;
+            }
+        }
+    }
+    return (int)tail;
+}
+
+struct DistanceField {
+    int width = 0;
+    int height = 0;
+    int sourceIndex = -1;
+    int* dist = nullptr;
+    int* queue = nullptr;
+    pair<int, int>* seeds = nullptr; // (distance, cell) boundary values for a repair
+    size_t seedCount = 0;
+    uint32_t* affectedStamp = nullptr;
+    uint32_t stamp = 0;
+    int lastTouchedCells = 0; // Cells whose distance the last edit re-examined
+
+    static size_t ArenaBytes(int w, int h) {
+        return (size_t)w * h * (2 * sizeof(int) + sizeof(pair<int, int>) + sizeof(uint32_t)) + 64;
+    }
+
+    static bool IsOpen(const MazeGrid& grid, int index) { return grid.cells[index] != '#'; }
+
+    // Buffers come from the level arena, so edits never allocate
+    void Attach(int w, int h) {
+        width = w;
+        height = h;
+        size_t cells = (size_t)w * h;
+        dist = levelArena.Allocate<int>(cells);
+        queue = levelArena.Allocate<int>(cells);
+        seeds = levelArena.Allocate<pair<int, int>>(cells);
+        affectedStamp = levelArena.Allocate<uint32_t>(cells);
+        seedCount = 0;
+        sourceIndex = -1;
+    }
+
+    int Get(int x, int y) const {
+        int d = dist[(size_t)y * width + x];
+        return d == UNREACHABLE ? -1 : d;
+    }
+
+    // Fills up to four neighbour indices of an in-bounds cell, returns how many
+    int Neighbours(int index, int* out) const {
+        int x = index % width, y = index / width, count = 0;
+        if (y > 0) out[count++] = index - width;
+        if (y < height - 1) out[count++] = index + width;
+        if (x < width - 1) out[count++] = index + 1;
+        if (x > 0) out[count++] = index - 1;
+        return count;
+    }
+
+    // Full BFS from the source over the grid the field was attached for
+    void Build(const MazeGrid& grid, int sourceX, int sourceY) {
+        sourceIndex = sourceY * width + sourceX;
+        fill(affectedStamp, affectedStamp + (size_t)width * height, 0);
+        seedCount = 0;
+        stamp = 0;
+        lastTouchedCells = fillDistancesFrom(grid, sourceIndex, dist, queue);
+    }
+
+    // Call after grid cell (x, y) changed from '#' to open
+    void OpenCell(const MazeGrid& grid, int x, int y) {
+        int c = y * width + x;
+        int nbrs[4];
+        int count = Neighbours(c, nbrs);
+        int best = UNREACHABLE;
+        for (int k = 0; k < count; ++k) {
+            if (IsOpen(grid, nbrs[k]) && dist[nbrs[k]] != UNREACHABLE) best = min(best, dist[nbrs[k]] + 1);
+        }
+        dist[c] = best;
+        lastTouchedCells = 1;
+        if (best == UNREACHABLE) return;
+
+        // Every push carries dist[u] + 1 for a u popped in order, so the FIFO stays sorted
+        size_t head = 0, tail = 0;
+        queue[tail++] = c;
+        while (head < tail) {
+            int u = queue[head++];
+            count = Neighbours(u, nbrs);
+            for (int k = 0; k < count; ++k) {
+                int v = nbrs[k];
+                if (IsOpen(grid, v) && dist[v] > dist[u] + 1) {
+                    dist[v] = dist[u] + 1;
+                    queue[tail++] = v;
+                }
+            }
+        }
+        lastTouchedCells = (int)tail;
+    }
+
+    // Call after grid cell (x, y) changed from open to '#'
+    void CloseCell(const MazeGrid& grid, int x, int y) {
+        int c = y * width + x;
+        int oldDist = dist[c];
+        dist[c] = UNREACHABLE;
+        lastTouchedCells = 1;
+        if (oldDist == UNREACHABLE) return;
+
+        if (++stamp == 0) {
+            fill(affectedStamp, affectedStamp + (size_t)width * height, 0);
+            stamp = 1;
+        }
+        affectedStamp[c] = stamp;
+
+        // 1. Collect the cells that lost their last shortest-path parent. Cells are visited
+        //    in increasing distance, so every affected parent is marked before its children
+        //    are checked.
+        size_t head = 0, tail = 0;
+        queue[tail++] = c;
+        int nbrs[4], parentNbrs[4];
+        while (head < tail) {
+            int u = queue[head++];
+            int uDist = (u == c) ? oldDist : dist[u];
+            int count = Neighbours(u, nbrs);
+            for (int k = 0; k < count; ++k) {
+                int v = nbrs[k];
+                if (!IsOpen(grid, v) || affectedStamp[v] == stamp || dist[v] != uDist + 1) continue;
+                bool supported = false;
+                int parentCount = Neighbours(v, parentNbrs);
+                for (int p = 0; p < parentCount && !supported; ++p) {
+                    int w = parentNbrs[p];
+                    supported = IsOpen(grid, w) && affectedStamp[w] != stamp && dist[w] == uDist;
+                }
+                if (!supported) {
+                    affectedStamp[v] = stamp;
+                    queue[tail++] = v;
+                }
+            }
+        }
+        size_t affectedCount = tail;
+
+        // 2. Clear the region and seed it from its boundary with the unaffected maze
+        seedCount = 0;
+        for (size_t i = 1; i < affectedCount; ++i) {
+            int a = queue[i];
+            dist[a] = UNREACHABLE;
+        }
+        for (size_t i = 1; i < affectedCount; ++i) {
+            int a = queue[i];
+            int best = UNREACHABLE;
+            int count = Neighbours(a, nbrs);
+            for (int k = 0; k < count; ++k) {
+                int w = nbrs[k];
+                if (IsOpen(grid, w) && affectedStamp[w] != stamp && dist[w] != UNREACHABLE) best = min(best, dist[w] + 1);
+            }
+            if (best != UNREACHABLE) seeds[seedCount++] = {best, a};
+        }
+        sort(seeds, seeds + seedCount);
+
+        // 3. Unit-weight Dijkstra inside the region: merge the sorted seeds with a FIFO
+        head = tail = 0;
+        size_t nextSeed = 0;
+        while (nextSeed < seedCount || head < tail) {
+            int u;
+            if (head < tail && (nextSeed == seedCount || dist[queue[head]] <= seeds[nextSeed].first)) {
+                u = queue[head++];
+            } else {
+                pair<int, int> seed = seeds[nextSeed++];
+                if (seed.first >= dist[seed.second]) continue;
+                dist[seed.second] = seed.first;
+                u = seed.second;
+            }
+            int count = Neighbours(u, nbrs);
+            for (int k = 0; k < count; ++k) {
+                int v = nbrs[k];
+                if (affectedStamp[v] == stamp && IsOpen(grid, v) && dist[v] > dist[u] + 1) {
+                    dist[v] = dist[u] + 1;
+                    queue[tail++] = v;
+                }
+            }
+        }
+        lastTouchedCells = (int)affectedCount;
+    }
+};
+
+DistanceField editorField; // Attached in setupGame, built when the editor opens
+
+// Helper function to find a valid ' ' cell for player/exit
+pair<int, int> findValidEmptyCell() {
+    uniform_int_distribution<> dist_x(1, mazeWidth - 2);
+    uniform_int_distribution<> dist_y(1, mazeHeight - 2);
+    int maxAttempts = 1000;
+    for (int attempts = 0; attempts < maxAttempts; ++attempts) {
+        int x = dist_x(rng);
+        int y = dist_y(rng);
+        if (maze[y][x] == ' ') {
+            return {x, y};
+        }
+    }
+    // Fallback if no random empty cell is found (shouldn't happen in a valid maze)
+    return {1, 1}; 
+}
+
+// --- Fog of War ---
+// Only cells the player has seen are drawn. "seen" and "visible" are packed bitsets over the
+// row-major cell index, drawn from the level arena. Each move re-runs recursive shadowcasting
+// from the player's new cell; the walls of the corridor stop every ray, so the work per move
+// is proportional to what is actually in view, never to the maze size.
+const int FOG_SIGHT_RADIUS = 8;
+bool fogOfWarEnabled = false;
+
+struct FogOfWar {
+    int width = 0;
+    int height = 0;
+    size_t words = 0;
+    uint64_t* seen = nullptr;
+    uint64_t* visible = nullptr;
+    int* visibleCells = nullptr; // Indices set in 'visible', so it can be cleared cheaply
+    int visibleCount = 0;
+
+    static size_t ArenaBytes(int w, int h) {
+        size_t bitsetWords = ((size_t)w * h + 63) / 64;
+        return 2 * bitsetWords * sizeof(uint64_t) + (size_t)(2 * FOG_SIGHT_RADIUS + 1) * (2 * FOG_SIGHT_RADIUS + 1) * sizeof(int) + 64;
+    }
+
+    void Attach(int w, int h) {
+        width = w;
+        height = h;
+        words = ((size_t)w * h + 63) / 64;
+        seen = levelArena.Allocate<uint64_t>(words);
+        visible = levelArena.Allocate<uint64_t>(words);
+        visibleCells = levelArena.Allocate<int>((size_t)(2 * FOG_SIGHT_RADIUS + 1) * (2 * FOG_SIGHT_RADIUS + 1));
+        memset(seen, 0, words * sizeof(uint64_t));
+        memset(visible, 0, words * sizeof(uint64_t));
+        visibleCount = 0;
+    }
+
+    bool IsVisible(int cell) const { return (visible[cell >> 6] >> (cell & 63)) & 1; }
+
+    void Mark(int x, int y) {
+        int cell = y * width + x;
+        uint64_t bit = 1ULL << (cell & 63);
+        if (visible[cell >> 6] & bit) return;
+        visible[cell >> 6] |= bit;
+        seen[cell >> 6] |= bit;
+        visibleCells[visibleCount++] = cell;
+    }
+
+    // One octant of recursive shadowcasting. (xx, xy, yx, yy) maps octant space to the grid.
+    void CastLight(const MazeGrid& grid, int cx, int cy, int row, float start, float end, int xx, int xy, int yx, int yy) {
+        if (start < end) return;
+        float newStart = 0.0f;
+        for (int j = row; j <= FOG_SIGHT_RADIUS; ++j) {
+            bool blocked = false;
+            for (int dx = -j, dy = -j; dx <= 0; ++dx) {
+                int x = cx + dx * xx + dy * xy;
+                int y = cy + dx * yx + dy * yy;
+                float leftSlope = (dx - 0.5f) / (dy + 0.5f);
+                float rightSlope = (dx + 0.5f) / (dy - 0.5f);
+                if (start < rightSlope) continue;
+                if (end > leftSlope) break;
+                if (x < 0 || x >= width || y < 0 || y >= height) continue;
+
+                if (dx * dx + dy * dy <= FOG_SIGHT_RADIUS * FOG_SIGHT_RADIUS) Mark(x, y);
+                bool wall = grid[y][x] == '#';
+                if (blocked) {
+                    if (wall) {
+                        newStart = rightSlope;
+                    } else {
+                        blocked = false;
+                        start = newStart;
+                    }
+                } else if (wall && j < FOG_SIGHT_RADIUS) {
+                    blocked = true;
+                    CastLight(grid, cx, cy, j + 1, start, leftSlope, xx, xy, yx, yy);
+                    newStart = rightSlope;
+                }
+            }
+            if (blocked) break;
+        }
+    }
+
+    // Recomputes what is in view from (px, py) and adds it to the explored set
+    void Update(const MazeGrid& grid, int px, int py) {
+        for (int i = 0; i < visibleCount; ++i) {
+            int cell = visibleCells[i];
+            visible[cell >> 6] &= ~(1ULL << (cell & 63));
+        }
+        visibleCount = 0;
+
+        static const int octants[8][4] = {
+            {1, 0, 0, 1}, {0, 1, 1, 0}, {0, -1, 1, 0}, {-1, 0, 0, 1},
+            {-1, 0, 0, -1}, {0, -1, -1, 0}, {0, 1, -1, 0}, {1, 0, 0, -1}
+        };
+        Mark(px, py);
+        for (const int* m : octants) {
+            CastLight(grid, px, py, 1, 1.0f, 0.0f, m[0], m[1], m[2], m[3]);
+        }
+    }
+
+    void Restart(const MazeGrid& grid, int px, int py) {
+        memset(seen, 0, words * sizeof(uint64_t));
+        Update(grid, px, py);
+    }
+};
+
+FogOfWar fogOfWar;
+
+// --- Chase Mode ---
+// Enemies hunt the player through the maze. Instead of one path search per enemy there is a
+// single flow field: a BFS from the player's cell that records, for every reachable cell,
+// the neighbouring cell one step closer to the player. It is rebuilt only when the player
+// changes cell, and an enemy step is then a single lookup. Total cost per player move is one
+// BFS plus O(enemies).
+const int chaseEnemyCounts[] = {4, 8, 16, 32, 40};
+const float enemyStepInterval = 0.35f; // Seconds between enemy steps
+const int enemySpawnMinDistance = 12;  // Enemies never start closer than this to the player
+bool chaseModeEnabled = false;
+
+struct FlowField {
+    int width = 0;
+    int height = 0;
+    int sourceCell = -1;
+    int* dist = nullptr;     // Steps to the player, UNREACHABLE if cut off
+    int* nextCell = nullptr; // Neighbour one step closer to the player (the player's cell maps to itself)
+    int* queue = nullptr;
+
+    static size_t ArenaBytes(int w, int h) { return (size_t)w * h * 3 * sizeof(int) + 64; }
+
+    void Attach(int w, int h) {
+        width = w;
+        height = h;
+        size_t cells = (size_t)w * h;
+        dist = levelArena.Allocate<int>(cells);
+        nextCell = levelArena.Allocate<int>(cells);
+        queue = levelArena.Allocate<int>(cells);
+        sourceCell = -1;
+    }
+
+    // Distances come from the shared BFS; each reached cell then points at a neighbour one
+    // step closer to the player
+    void Build(const MazeGrid& grid, int x, int y) {
+        sourceCell = y * width + x;
+        int reached = fillDistancesFrom(grid, sourceCell, dist, queue);
+        nextCell[sourceCell] = sourceCell;
+        for (int i = 1; i < reached; ++i) {
+            int v = queue[i];
+            int vx = v % width, vy = v / width;
+            int closer = dist[v] - 1;
+            if (vy > 0 && dist[v - width] == closer) nextCell[v] = v - width;
+            else if (vy < height - 1 && dist[v + width] == closer) nextCell[v] = v + width;
+            else if (vx < width - 1 && dist[v + 1] == closer) nextCell[v] = v + 1;
+            else nextCell[v] = v - 1; // Some neighbour is one step closer, so it is this one
+        }
+    }
+};
+
+// Struct-of-arrays enemy state, so a step is one tight loop over flat arrays
+struct EnemySwarm {
+    int capacity = 0;
+    int count = 0;
+    int* cell = nullptr;
+    float* renderX = nullptr;
+    float* renderY = nullptr;
+    float stepTimer = 0.0f;
+
+    static size_t ArenaBytes(int maxEnemies) { return (size_t)maxEnemies * (sizeof(int) + 2 * sizeof(float)) + 64; }
+
+    void Attach(int maxEnemies) {
+        capacity = maxEnemies;
+        count = 0;
+        cell = levelArena.Allocate<int>(maxEnemies);
+        renderX = levelArena.Allocate<float>(maxEnemies);
+        renderY = levelArena.Allocate<float>(maxEnemies);
+    }
+
+    // Places enemies on random open cells that are far enough from the player
+    template <typename RNG>
+    void Spawn(const MazeGrid& grid, const FlowField& flow, int wanted, RNG& gen) {
+        uniform_int_distribution<int> distX(1, grid.width - 2);
+        uniform_int_distribution<int> distY(1, grid.height - 2);
+        count = 0;
+        stepTimer = 0.0f;
+        for (int attempts = 0; count < min(wanted, capacity) && attempts < wanted * 1000; ++attempts) {
+            int x = distX(gen), y = distY(gen);
+            int c = y * grid.width + x;
+            if (grid.cells[c] != ' ' || flow.dist[c] == UNREACHABLE || flow.dist[c] < enemySpawnMinDistance) continue;
+            cell[count] = c;
+            renderX[count] = (float)x;
+            renderY[count] = (float)y;
+            ++count;
+        }
+    }
+
+    // Moves every enemy one cell along the flow field. Returns true if one reaches the player.
+    bool Step(const FlowField& flow) {
+        bool caught = false;
+        for (int i = 0; i < count; ++i) {
+            int next = flow.dist[cell[i]] != UNREACHABLE ? flow.nextCell[cell[i]] : cell[i];
+            cell[i] = next;
+            caught |= (next == flow.sourceCell);
+        }
+        return caught;
+    }
+
+    bool Occupies(int c) const {
+        for (int i = 0; i < count; ++i) {
+            if (cell[i] == c) return true;
+        }
+        return false;
+    }
+};
+
+FlowField chaseFlow;
+EnemySwarm chaseEnemies;
+
+void startChase() {
+    chaseFlow.Build(maze, playerX, playerY);
+    chaseEnemies.Spawn(maze, chaseFlow, chaseEnemyCounts[currentLevelIndex], rng);
+}
+
+// Advances the chase by one frame. Returns true if the player was caught.
+bool updateChaseMode(float dt) {
+    int playerCell = playerY * mazeWidth + playerX;
+    if (playerCell != chaseFlow.sourceCell) {
+        chaseFlow.Build(maze, playerX, playerY);
+        if (chaseEnemies.Occupies(playerCell)) return true; // Walked into an enemy
+    }
+
+    chaseEnemies.stepTimer += dt;
+    bool caught = false;
+    while (chaseEnemies.stepTimer >= enemyStepInterval) {
+        chaseEnemies.stepTimer -= enemyStepInterval;
+        caught |= chaseEnemies.Step(chaseFlow);
+    }
+
+    for (int i = 0; i < chaseEnemies.count; ++i) {
+        float targetX = (float)(chaseEnemies.cell[i] % mazeWidth);
+        float targetY = (float)(chaseEnemies.cell[i] / mazeWidth);
+        chaseEnemies.renderX[i] += (targetX - chaseEnemies.renderX[i]) * playerMoveSpeed * dt;
+        chaseEnemies.renderY[i] += (targetY - chaseEnemies.renderY[i]) * playerMoveSpeed * dt;
+    }
+    return caught;
+}
+
+void drawChaseEnemies() {
+    for (int i = 0; i < chaseEnemies.count; ++i) {
+        int c = chaseEnemies.cell[i];
+        if (fogOfWarEnabled && !fogOfWar.IsVisible(c)) continue;
+        DrawCircle((int)(chaseEnemies.renderX[i] * TILE_SIZE + mazeOffsetX + TILE_SIZE / 2),
+                   (int)(chaseEnemies.renderY[i] * TILE_SIZE + mazeOffsetY + TILE_SIZE / 2),
+                   TILE_SIZE / 2 - 4, RED);
+    }
+}
+
+// --- General Game Functions ---
+void generateLevelMaze(int levelIdx) {
+    // ⭐⭐ Generate maze using the appropriate algorithm (EASY/MEDIUM SWAPPED) ⭐⭐
+    switch (levelIdx) {
+        case 0: generateMazeBFS(1, 1, rng); break;   // Now EASY (using the less complex BFS structure)
+        case 1: generateMazeDFS(1, 1, rng); break;   // Now MEDIUM (using the more complex DFS structure)
+        case 2: generateMazeKruskal(); break;
+        case 3: generateMazePrim(1, 1); break;
+        case 4: resetMazeGrid(); generateMazeDivision(maze, ((uint64_t)rng() << 32) | rng()); break;
+        default: generateMazeDFS(1, 1, rng); break;
+    }
+    // ⭐⭐ END SWAP ⭐⭐
+}
+
+// --- Player and Exit Placement based on Strategy ---
+void placeEntranceAndExit(EntranceExitStrategy strategy) {
+    switch (strategy) {
+        case RANDOM_PLACEMENT: {
+            pair<int, int> playerPos = findValidEmptyCell();
+            playerX = playerPos.first;
+            playerY = playerPos.second;
+
+            pair<int, int> exitPos;
+            int maxAttempts = 1000;
+            int attempts = 0;
+            do {
+                exitPos = findValidEmptyCell();
+                attempts++;
+            } while ((exitPos.first == playerX && exitPos.second == playerY) && attempts < maxAttempts);
+            exitX = exitPos.first;
+            exitY = exitPos.second;
+        } break;
+
+        case TOP_LEFT_BOTTOM_RIGHT: {
+            playerX = 1; // Top-left
+            playerY = 1;
+            while(maze[playerY][playerX] == '#') { // Ensure player starts on a path
+                playerX++; 
+                if (playerX >= mazeWidth - 1) { playerX = 1; playerY++; }
+                if (playerY >= mazeHeight - 1) { playerY = 1; break; } // Should not happen in valid maze
+            }
+
+            exitX = mazeWidth - 2; // Bottom-right
+            exitY = mazeHeight - 2;
+            while(maze[exitY][exitX] == '#') { // Ensure exit is on a path
+                exitX--; 
+                if (exitX <= 0) { exitX = mazeWidth - 2; exitY--; }
+                if (exitY <= 0) { exitY = mazeHeight - 2; break; } // Should not happen
+            }
+            // Ensure player and exit are not the same (unlikely but good safeguard)
+            if (playerX == exitX && playerY == exitY) {
+                exitX = mazeWidth - 4; // Shift exit if it overlaps
+                exitY = mazeHeight - 4;
+            }
+
+        } break;
+
+        case LEFT_RIGHT_CENTER: {
+            // Find a valid spot on the left edge (y-coordinate in the middle-ish)
+            playerX = 1;
+            playerY = mazeHeight / 2;
+            for (int scanned = 0; maze[playerY][playerX] == '#'; ++scanned) {
+                playerY++;
+                if (playerY >= mazeHeight - 1) playerY = 1; // Wrap around if needed
+                if (scanned == mazeHeight - 2) { playerX++; scanned = 0; } // Column is solid wall, step inward
+            }
+
+            // Find a valid spot on the right edge (y-coordinate in the middle-ish)
+            exitX = mazeWidth - 2;
+            exitY = mazeHeight / 2;
+            for (int scanned = 0; maze[exitY][exitX] == '#'; ++scanned) {
+                exitY++;
+                if (exitY >= mazeHeight - 1) exitY = 1; // Wrap around if needed
+                if (scanned == mazeHeight - 2) { exitX--; scanned = 0; } // Column is solid wall, step inward
+            }
+            // Ensure player and exit are not the same
+            if (playerX == exitX && playerY == exitY) {
+                exitX = mazeWidth - 4; // Shift exit if it overlaps
+            }
+
+        } break;
+    }
+}
+
+void setupGame(int levelIdx, EntranceExitStrategy strategy) {
+    currentLevelIndex = levelIdx;
+    
+    // Set maze dimensions based on level
+    switch (levelIdx) {
+        case 0: mazeWidth = 31; mazeHeight = 15; break;      // Easy
+        case 1: mazeWidth = 41; mazeHeight = 21; break;      // Medium
+        case 2: mazeWidth = 51; mazeHeight = 25; break;      // Hard
+        case 3: mazeWidth = 61; mazeHeight = 31; break;      // Very Hard
+        case 4: mazeWidth = 61; mazeHeight = 31; break;      // Long Walls
+        default: mazeWidth = 51; mazeHeight = 25; break; 
+    }
+    
+    // Ensure maze dimensions are odd for proper generation with Prim's/DFS/BFS
+    if (mazeWidth % 2 == 0) mazeWidth++;
+    if (mazeHeight % 2 == 0) mazeHeight++;
+
+    // Release everything the previous level drew from the arena in one step
+    levelArena.Reset(levelArenaBytes(mazeWidth, mazeHeight) + FogOfWar::ArenaBytes(mazeWidth, mazeHeight) + DistanceField::ArenaBytes(mazeWidth, mazeHeight) +
+                     FlowField::ArenaBytes(mazeWidth, mazeHeight) + EnemySwarm::ArenaBytes(chaseEnemyCounts[LEVEL_COUNT - 1]));
+    loadEventThisFrame = true;
+
+    // Dynamically calculate offsets to center the maze
+    mazeOffsetX = (fixedScreenWidth - mazeWidth * TILE_SIZE) / 2;
+    mazeOffsetY = (fixedScreenHeight - mazeHeight * TILE_SIZE - HUD_HEIGHT) / 2 + HUD_HEIGHT;
+    if (mazeOffsetX < 0) mazeOffsetX = 0;
+    if (mazeOffsetY < 0) mazeOffsetY = 0;
+    
+    generateLevelMaze(levelIdx);
+    if (levelIdx == 0 || levelIdx == 1) {
+        TraceLog(LOG_INFO, "MAZE: %dx%d carved with %zu allocations in the carving loop", mazeWidth, mazeHeight, lastCarveAllocations);
+    }
+
+    // --- Player and Exit Placement based on Strategy ---
+    placeEntranceAndExit(strategy);
+
+    // Every level must be a perfect maze with a closed border and open endpoints
+    MazeValidation validation = levelValidator.Validate(maze, playerX, playerY, exitX, exitY);
+    if (!validation.IsPerfect()) {
+        TraceLog(LOG_WARNING, "MAZE: Level %d failed validation (border %d, endpoints %d, connected %d, acyclic %d)", levelIdx,
+                 validation.borderClosed, validation.endpointsOpen, validation.connected, validation.acyclic);
+    }
+
+    maze[exitY][exitX] = 'E';
+
+    idealMoves = calculateShortestPathLength(playerX, playerY, exitX, exitY);
+    if (idealMoves == -1) {
+        TraceLog(LOG_WARNING, "No path found in generated maze!");
+        idealMoves = 0;
+    }
+
+    // 1. Player Render Position Initialize for Smooth Movement
+    playerRenderX = (float)playerX;
+    playerRenderY = (float)playerY;
+
+    // 2. Pulse Timer Initialize
+    pulseTimer = 0.0f;
+
+    fogOfWar.Attach(mazeWidth, mazeHeight);
+    fogOfWar.Restart(maze, playerX, playerY);
+
+    editorField.Attach(mazeWidth, mazeHeight);
+
+    chaseFlow.Attach(mazeWidth, mazeHeight);
+    chaseEnemies.Attach(chaseEnemyCounts[LEVEL_COUNT - 1]);
+    chaseEnemies.count = 0;
+    if (chaseModeEnabled) startChase();
+
+    // 3. Reset Game Stats
+    totalTime = 0.0f;
+    totalMoves = 0;
+
+}
+
+void drawMazeTile(int i, int j) {
+    Rectangle tile = { (float)(j * TILE_SIZE + mazeOffsetX), (float)(i * TILE_SIZE + mazeOffsetY), (float)TILE_SIZE, (float)TILE_SIZE };
+    
+    if (maze[i][j] == '#') {
+        // Draw a darker base for the brick
+        DrawRectangleRec(tile, GetColor(0x4A4A4AFF)); // Darker gray for the main brick body
+        // Draw a lighter highlight for a simple 3D effect
+        DrawRectangle(tile.x, tile.y, TILE_SIZE, 2, GetColor(0x606060FF)); // Top edge highlight
+        DrawRectangle(tile.x, tile.y, 2, TILE_SIZE, GetColor(0x606060FF)); // Left edge highlight
+    } 
+    //     else if (maze[i][j] == 'E') {
+    //     // ⭐ Exit Sign Pulsing Logic
+    //     float pulseFactor = sin(pulseTimer) * 0.5f + 0.5f; // Goes from 0.0 (dim) to 1.0 (bright)
+
+    //     // Blend between LIME (base color) and WHITE (highlight color)
+    //     Color baseColor = LIME;
+        
+    //     // ম্যানুয়ালি কালার ব্লেন্ড করা
+    //     Color finalColor;
+    //     finalColor.r = (unsigned char)(baseColor.r * (1.0f - pulseFactor) + WHITE.r * pulseFactor);
+    //     finalColor.g = (unsigned char)(baseColor.g * (1.0f - pulseFactor) + WHITE.g * pulseFactor);
+    //     finalColor.b = (unsigned char)(baseColor.b * (1.0f - pulseFactor) + WHITE.b * pulseFactor);
+    //     finalColor.a = 255;
+        
+    //     Vector2 triA = { tile.x + TILE_SIZE / 2, tile.y + TILE_SIZE / 4 };
+    //     Vector2 triB = { tile.x + TILE_SIZE / 4, tile.y + TILE_SIZE - TILE_SIZE / 4 };
+    //     Vector2 triC = { tile.x + TILE_SIZE - TILE_SIZE / 4, tile.y + TILE_SIZE - TILE_SIZE / 4 };
+    //     DrawTriangle(triA, triB, triC, finalColor); // ⭐ finalColor ব্যবহার করা হয়েছে
+    // }
+
+    else if (maze[i][j] == 'E') {
+        // ⭐⭐ Color and Brightness Pulsing Logic (Using HSV) ⭐⭐
+        
+        float pulseFactor = sin(pulseTimer) * 0.5f + 0.5f; // Goes from 0.0 (dim) to 1.0 (bright)
+
+        // 1. Hue Shifting: Time-based color change (from Green to Yellow/Cyan)
+        // pulseTimer ব্যবহার করে Hue পরিবর্তন করা হচ্ছে
+        float hue = 120.0f + sin(pulseTimer * 0.5f) * 60.0f; // 120 (Green) থেকে 60 (Yellow) পর্যন্ত
+        
+        // 2. Value Pulsing: Brightness change
+        float value = 0.8f + pulseFactor * 0.2f; // 80% থেকে 100% উজ্জ্বলতা
+
+        // HSV থেকে Color এ রূপান্তর
+        Color finalColor = ColorFromHSV(hue, 1.0f, value);
+        
+        // Draw the Exit Triangle
+        Vector2 tile = { (float)(j * TILE_SIZE + mazeOffsetX), (float)(i * TILE_SIZE + mazeOffsetY) };
+        
+        Vector2 triA = { tile.x + TILE_SIZE / 2, tile.y + TILE_SIZE / 4 };
+        Vector2 triB = { tile.x + TILE_SIZE / 4, tile.y + TILE_SIZE - TILE_SIZE / 4 };
+        Vector2 triC = { tile.x + TILE_SIZE - TILE_SIZE / 4, tile.y + TILE_SIZE - TILE_SIZE / 4 };
+        
+        DrawTriangle(triA, triB, triC, finalColor); 
+    }
+}
+
+// Fog-of-war drawing: one dark rectangle for the whole maze, then only the explored cells on
+// top. Whole 64-cell words of the seen bitset that are still zero are skipped, and cells that
+// were explored but are not in view right now are dimmed.
+void drawMazeFog() {
+    DrawRectangle(mazeOffsetX, mazeOffsetY, mazeWidth * TILE_SIZE, mazeHeight * TILE_SIZE, GetColor(0x202020FF));
+    for (size_t w = 0; w < fogOfWar.words; ++w) {
+        uint64_t bits = fogOfWar.seen[w];
+        while (bits) {
+            int bit = __builtin_ctzll(bits);
+            bits &= bits - 1;
+            int cell = (int)(w * 64 + bit);
+            int i = cell / mazeWidth;
+            int j = cell % mazeWidth;
+            int x = j * TILE_SIZE + mazeOffsetX;
+            int y = i * TILE_SIZE + mazeOffsetY;
+            DrawRectangle(x, y, TILE_SIZE, TILE_SIZE, GetColor(0xF5F5F5FF)); // Same floor colour as the background
+            drawMazeTile(i, j);
+            if (!fogOfWar.IsVisible(cell)) {
+                DrawRectangle(x, y, TILE_SIZE, TILE_SIZE, Fade(BLACK, 0.35f));
+            }
+        }
+    }
+}
+
+void drawMaze() {
+    if (fogOfWarEnabled && currentScreen == GAMEPLAY) {
+        drawMazeFog();
+        return;
+    }
+    for (int i = 0; i < mazeHeight; ++i) {
+        for (int j = 0; j < mazeWidth; ++j) {
+            drawMazeTile(i, j);
+        }
+    }
+}
+
+void handleGameplayInput() {
+    int oldX = playerX;
+    int oldY = playerY;
+
+    if (IsKeyPressed(KEY_W) || IsKeyPressed(KEY_UP)) playerY--;
+    else if (IsKeyPressed(KEY_S) || IsKeyPressed(KEY_DOWN)) playerY++;
+    else if (IsKeyPressed(KEY_A) || IsKeyPressed(KEY_LEFT)) playerX--;
+    else if (IsKeyPressed(KEY_D) || IsKeyPressed(KEY_RIGHT)) playerX++;
 
     if (oldX != playerX || oldY != playerY) {
         if (playerY >= 0 && playerY < mazeHeight && playerX >= 0 && playerX < mazeWidth && maze[playerY][playerX] == '#') {
@@ -615,6 +2260,7 @@ void handleGameplayInput() {
             playerY = oldY;
         } else {
             totalMoves++;
+            if (fogOfWarEnabled) fogOfWar.Update(maze, playerX, playerY);
         }
     }
 }
@@ -623,8 +2269,639 @@ bool checkWinCondition() {
     return (playerX == exitX && playerY == exitY);
 }
 
+// --- Idle-Aware Frame Pacing ---
+// Static screens do not need 60 redraws a second. While nothing on the current screen is
+// animating, raylib's event waiting is switched on, so EndDrawing() sleeps until input
+// arrives instead of spinning. Any running animation switches back to fixed 60 FPS.
+const char* screenNames[] = {"HOME", "LEVEL_SELECT", "GAMEPLAY", "WIN", "GAMEOVER", "EDITOR"};
+bool eventWaitingActive = false;
+
+// raylib measures a frame from one BeginDrawing() to the next, so the time spent asleep in
+// the last idle EndDrawing() lands in the first GetFrameTime() after waiting is switched
+// off. That frame's time is dropped; otherwise a long pause in the editor would be charged
+// to the level timer (and to the enemy step clock) the moment play starts.
+bool discardNextFrameTime = false;
+const float MAX_GAMEPLAY_FRAME_TIME = 0.1f; // Also caps stalls such as a dragged window
+
+// Wakeups and CPU time per screen. CPU time comes from clock(), which is process CPU time on
+// POSIX systems (on Windows it measures wall time, so the CPU figure reads 100% there).
+struct ScreenPacing {
+    double windowWall = 0.0, windowCpu = 0.0;
+    int windowFrames = 0;
+    float wakeupsPerSecond = 0.0f; // Over the last full one-second window
+    float cpuPercent = 0.0f;
+    double visitWall = 0.0, visitCpu = 0.0;
+    int visitFrames = 0;
+
+    void AddFrame(double wallSeconds, double cpuSeconds) {
+        windowWall += wallSeconds;
+        windowCpu += cpuSeconds;
+        windowFrames++;
+        visitWall += wallSeconds;
+        visitCpu += cpuSeconds;
+        visitFrames++;
+        if (windowWall >= 1.0) {
+            wakeupsPerSecond = (float)(windowFrames / windowWall);
+            cpuPercent = (float)(100.0 * windowCpu / windowWall);
+            windowWall = windowCpu = 0.0;
+            windowFrames = 0;
+        }
+    }
+};
+
+ScreenPacing screenPacing[6];
+
+// Logs the totals for the visit that is ending and starts a new one
+void endScreenVisit(GameScreen screen) {
+    ScreenPacing& pacing = screenPacing[screen];
+    if (pacing.visitWall > 0.0) {
+        TraceLog(LOG_INFO, "PACING: %s: %.1fs, %.1f wakeups/s, %.1f%% CPU", screenNames[screen], pacing.visitWall,
+                 pacing.visitFrames / pacing.visitWall, 100.0 * pacing.visitCpu / pacing.visitWall);
+    }
+    pacing.visitWall = pacing.visitCpu = 0.0;
+    pacing.visitFrames = 0;
+}
+
+bool screenIsAnimating() {
+    switch (currentScreen) {
+        case HOME:
+            return !welcomeTextAnim.animationComplete || pressEnterTextEffect.isActive;
+        case LEVEL_SELECT:
+            for (const ScrambleTextEffect& effect : levelButtonsTextEffects) {
+                if (effect.isActive) return true;
+            }
+            return false;
+        case GAMEPLAY:
+            return true; // Timer, exit pulse, smooth movement and enemies
+        default:
+            return false; // WIN, GAMEOVER and the editor only change on input
+    }
+}
+
+// Called after the update pass, before drawing, so the frame that finishes an animation is
+// still drawn before the loop goes to sleep.
+void updateEventWaiting() {
+    bool idle = !screenIsAnimating();
+    if (idle == eventWaitingActive) return;
+    if (idle) EnableEventWaiting();
+    else DisableEventWaiting();
+    if (!idle) discardNextFrameTime = true;
+    eventWaitingActive = idle;
+}
+
+// --- Retained Menu Layer ---
+// HOME, LEVEL_SELECT, WIN and GAMEOVER are laid out once: text is measured and positions are
+// fixed when the screen is built. Each frame the update pass handles input exactly once and
+// the draw pass only draws the cached result.
+struct MenuLabel {
+    string text;
+    int fontSize;
+    int x, y;
+    Color color;
+};
+
+struct MenuScreenLayout {
+    vector<MenuLabel> labels;
+
+    // Adds a label centered horizontally on the screen. This is the only place its text is measured.
+    void AddCentered(const char* text, int y, int fontSize, Color color) {
+        labels.push_back({text, fontSize, GetScreenWidth() / 2 - MeasureText(text, fontSize) / 2, y, color});
+    }
+
+    void Draw() const {
+        for (const MenuLabel& label : labels) {
+            DrawText(label.text.c_str(), label.x, label.y, label.fontSize, label.color);
+        }
+    }
+};
+
+MenuScreenLayout homeLayout;
+MenuScreenLayout levelSelectLayout;
+MenuScreenLayout levelSelectModesLayout; // Rebuilt when a game mode is toggled
+MenuScreenLayout winLayout;
+MenuScreenLayout gameOverLayout;
+
+Vector2 logoPosition;
+const float logoScale = 0.4f;
+Rectangle logoPlaceholder;
+Rectangle pressEnterRect;
+Rectangle levelButtonRects[LEVEL_COUNT];
+
+const int welcomeTextSize = 50;
+const int pressEnterTextSize = 30;
+const int levelButtonTextSize = 30;
+
+// Layouts that never change while the game runs
+void buildStaticMenuLayouts() {
+    int screenW = GetScreenWidth();
+    int screenH = GetScreenHeight();
+
+    homeLayout.labels.clear();
+    if (logoTexture.id != 0) {
+        logoPosition = { screenW / 2 - (logoTexture.width * logoScale) / 2, screenH / 2 - (logoTexture.height * logoScale) / 2 - 150 };
+    } else {
+        // Placeholder for logo if it fails to load
+        logoPlaceholder = { (float)screenW / 2 - 100, (float)screenH / 2 - 250, 200, 100 };
+        homeLayout.AddCentered("LOGO", (int)(logoPlaceholder.y + logoPlaceholder.height / 2 - 15), 30, GRAY);
+    }
+    pressEnterRect = {
+        (float)screenW / 2 - pressEnterTextEffect.originalWidth / 2,
+        (float)screenH / 2 + 100,
+        (float)pressEnterTextEffect.originalWidth,
+        (float)pressEnterTextSize
+    };
+
+    levelSelectLayout.labels.clear();
+    levelSelectLayout.AddCentered("Select Level:", 50, 40, BLACK);
+
+    int buttonYStart = 150;
+    int buttonSpacing = 70;
+    int buttonWidth = 300;
+    int buttonHeight = 60;
+    for (int i = 0; i < LEVEL_COUNT; ++i) {
+        levelButtonRects[i] = {(float)screenW / 2 - buttonWidth / 2, (float)(buttonYStart + i * buttonSpacing), (float)buttonWidth, (float)buttonHeight};
+    }
+    levelSelectLayout.AddCentered("Right-click a level to open it in the editor", buttonYStart + LEVEL_COUNT * buttonSpacing + 10, 20, GRAY);
+}
+
+void buildLevelSelectModesLayout() {
+    levelSelectModesLayout.labels.clear();
+    levelSelectModesLayout.AddCentered(fogOfWarEnabled ? "Fog of War: ON (press F)" : "Fog of War: OFF (press F)", 540, 20, fogOfWarEnabled ? DARKBLUE : GRAY);
+    levelSelectModesLayout.AddCentered(chaseModeEnabled ? "Chase Mode: ON (press C)" : "Chase Mode: OFF (press C)", 570, 20, chaseModeEnabled ? DARKBLUE : GRAY);
+}
+
+// The result screens show the stats of the run that just ended, so they are rebuilt on entry
+void buildWinLayout() {
+    int screenH = GetScreenHeight();
+    winLayout.labels.clear();
+    winLayout.AddCentered("You Won!", screenH / 2 - 80, 40, DARKGREEN);
+    winLayout.AddCentered(TextFormat("Time Taken: %.2f seconds", totalTime), screenH / 2 - 30, 20, BLACK);
+    winLayout.AddCentered(TextFormat("Total Moves: %i", totalMoves), screenH / 2 + 0, 20, BLACK);
+    winLayout.AddCentered(TextFormat("Ideal Moves: %i", idealMoves), screenH / 2 + 30, 20, BLACK);
+    winLayout.AddCentered(TextFormat("Accuracy: %.2f%%", accuracy), screenH / 2 + 70, 30, (accuracy >= 80.0f) ? BLUE : RED);
+    winLayout.AddCentered("Press ENTER to go to Level Select", screenH / 2 + 120, 20, GRAY);
+}
+
+const char* gameOverMessage = "Time's up! You couldn't solve the maze.";
+
+void buildGameOverLayout() {
+    int screenH = GetScreenHeight();
+    gameOverLayout.labels.clear();
+    gameOverLayout.AddCentered("GAME OVER!", screenH / 2 - 80, 40, RED);
+    gameOverLayout.AddCentered(gameOverMessage, screenH / 2, 20, BLACK);
+    gameOverLayout.AddCentered("Press ENTER to go to Level Select", screenH / 2 + 30, 20, GRAY);
+}
+
+void changeScreen(GameScreen next) {
+    endScreenVisit(currentScreen);
+    currentScreen = next;
+    loadEventThisFrame = true;
+    if (next == WIN) buildWinLayout();
+    else if (next == GAMEOVER) buildGameOverLayout();
+}
+
+// Select strategy based on level for now
+EntranceExitStrategy strategyForLevel(int levelIdx) {
+    if (levelIdx == 0 || levelIdx == 1) { // Easy and Medium are random
+        return RANDOM_PLACEMENT;
+    } else if (levelIdx == 2 || levelIdx == 4) { // Hard and Long Walls are top-left to bottom-right
+        return TOP_LEFT_BOTTOM_RIGHT;
+    }
+    return LEFT_RIGHT_CENTER; // Very Hard is left-center to right-center
+}
+
+// --- Maze Editor ---
+// Hold the left mouse button to paint: starting on a wall opens cells, starting on a path
+// closes them. The distance-to-exit field is patched after every toggle, so reachability
+// and the ideal move count stay live while painting.
+bool editorPaintOpen = false;
+int editorLastPaintedCell = -1;
+
+void openEditor() {
+    editorField.Build(maze, exitX, exitY);
+    editorLastPaintedCell = -1;
+    changeScreen(EDITOR);
+}
+
+bool isEditableCell(int x, int y) {
+    if (x <= 0 || x >= mazeWidth - 1 || y <= 0 || y >= mazeHeight - 1) return false; // Keep the border closed
+    return !(x == playerX && y == playerY) && !(x == exitX && y == exitY);
+}
+
+void updateEditorScreen() {
+    Vector2 mouse = GetMousePosition();
+    int cellX = (int)floorf((mouse.x - mazeOffsetX) / TILE_SIZE);
+    int cellY = (int)floorf((mouse.y - mazeOffsetY) / TILE_SIZE);
+    bool editable = isEditableCell(cellX, cellY);
+
+    if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT) && editable) {
+        editorPaintOpen = (maze[cellY][cellX] == '#');
+        editorLastPaintedCell = -1;
+    }
+    if (IsMouseButtonDown(MOUSE_BUTTON_LEFT) && editable && cellY * mazeWidth + cellX != editorLastPaintedCell) {
+        editorLastPaintedCell = cellY * mazeWidth + cellX;
+        bool isWall = (maze[cellY][cellX] == '#');
+        if (editorPaintOpen && isWall) {
+            maze[cellY][cellX] = ' ';
+            editorField.OpenCell(maze, cellX, cellY);
+        } else if (!editorPaintOpen && !isWall) {
+            maze[cellY][cellX] = '#';
+            editorField.CloseCell(maze, cellX, cellY);
+        }
+    }
+
+    if (IsKeyPressed(KEY_ENTER) && editorField.Get(playerX, playerY) > 0) {
+        idealMoves = editorField.Get(playerX, playerY);
+        fogOfWar.Restart(maze, playerX, playerY); // Edits may have changed what the start cell can see
+        if (chaseModeEnabled) startChase();           // ...and where enemies can stand
+        changeScreen(GAMEPLAY);
+    } else if (IsKeyPressed(KEY_BACKSPACE)) {
+        changeScreen(LEVEL_SELECT);
+    }
+}
+
+void drawEditorScreen() {
+    drawMaze();
+
+    // Open cells the exit can no longer reach
+    for (int y = 1; y < mazeHeight - 1; ++y) {
+        for (int x = 1; x < mazeWidth - 1; ++x) {
+            if (maze[y][x] != '#' && editorField.Get(x, y) < 0) {
+                DrawRectangle(x * TILE_SIZE + mazeOffsetX, y * TILE_SIZE + mazeOffsetY, TILE_SIZE, TILE_SIZE, Fade(RED, 0.25f));
+            }
+        }
+    }
+    DrawCircle(playerX * TILE_SIZE + mazeOffsetX + TILE_SIZE / 2, playerY * TILE_SIZE + mazeOffsetY + TILE_SIZE / 2, TILE_SIZE / 2 - 2, BLUE);
+
+    Rectangle hudBackground = { 0, 0, (float)GetScreenWidth(), (float)HUD_HEIGHT };
+    DrawRectangleRec(hudBackground, GetColor(0xE0E0E0FF));
+    int playerDistance = editorField.Get(playerX, playerY);
+    if (playerDistance > 0) {
+        DrawText(TextFormat("EDITOR - Exit reachable, ideal moves: %i", playerDistance), 10, 10, 20, DARKGREEN);
+    } else {
+        DrawText("EDITOR - Exit NOT reachable", 10, 10, 20, RED);
+    }
+    DrawText(TextFormat("Last edit re-checked %i cells", editorField.lastTouchedCells), 10, 40, 20, BLACK);
+    const char* help = "Hold LMB to paint walls/paths | ENTER: play | BACKSPACE: back";
+    DrawText(help, GetScreenWidth() - MeasureText(help, 20) - 10, 40, 20, DARKBLUE);
+}
+
+void updateHomeScreen(float dt) {
+    welcomeTextAnim.Update(dt);
+    if (CheckCollisionPointRec(GetMousePosition(), pressEnterRect)) {
+        pressEnterTextEffect.Start();
+    } else {
+        pressEnterTextEffect.Stop();
+    }
+    pressEnterTextEffect.Update(dt);
+
+    if (IsKeyPressed(KEY_ENTER)) {
+        changeScreen(LEVEL_SELECT);
+    }
+}
+
+void updateLevelSelectScreen(float dt) {
+    if (IsKeyPressed(KEY_F)) {
+        fogOfWarEnabled = !fogOfWarEnabled;
+        buildLevelSelectModesLayout();
+        loadEventThisFrame = true;
+    }
+    if (IsKeyPressed(KEY_C)) {
+        chaseModeEnabled = !chaseModeEnabled;
+        buildLevelSelectModesLayout();
+        loadEventThisFrame = true;
+    }
+
+    Vector2 mouse = GetMousePosition();
+    for (int i = 0; i < LEVEL_COUNT; ++i) {
+        bool hovered = CheckCollisionPointRec(mouse, levelButtonRects[i]);
+        if (hovered) {
+            levelButtonsTextEffects[i].Start();
+        } else {
+            levelButtonsTextEffects[i].Stop();
+        }
+        levelButtonsTextEffects[i].Update(dt);
+
+        // Same press rule as GuiButton: released while the cursor is over the button
+        if (hovered && IsMouseButtonReleased(MOUSE_BUTTON_LEFT)) {
+            setupGame(i, strategyForLevel(i));
+            changeScreen(GAMEPLAY);
+            return;
+        }
+        if (hovered && IsMouseButtonReleased(MOUSE_BUTTON_RIGHT)) {
+            setupGame(i, strategyForLevel(i));
+            openEditor();
+            return;
+        }
+    }
+}
+
+void drawHomeScreen() {
+    if (logoTexture.id != 0) {
+        DrawTextureEx(logoTexture, logoPosition, 0.0f, logoScale, WHITE);
+    } else {
+        DrawRectangleRec(logoPlaceholder, LIGHTGRAY);
+    }
+    homeLayout.Draw();
+
+    int screenW = GetScreenWidth();
+    int screenH = GetScreenHeight();
+    DrawText(welcomeTextAnim.displayedText.c_str(), screenW / 2 - welcomeTextAnim.textWidth / 2, screenH / 2 - welcomeTextSize / 2, welcomeTextSize, DARKBLUE);
+    DrawText(pressEnterTextEffect.GetText().c_str(), screenW / 2 - pressEnterTextEffect.textWidth / 2, (int)pressEnterRect.y, pressEnterTextSize, DARKGRAY);
+}
+
+void drawLevelSelectScreen() {
+    levelSelectLayout.Draw();
+    levelSelectModesLayout.Draw();
+
+    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+    for (int i = 0; i < LEVEL_COUNT; ++i) {
+        const Rectangle& buttonRect = levelButtonRects[i];
+        GuiButton(buttonRect, ""); // Visuals only, presses are handled in updateLevelSelectScreen
+
+        const ScrambleTextEffect& effect = levelButtonsTextEffects[i];
+        float textX = buttonRect.x + buttonRect.width / 2 - effect.textWidth / 2;
+        float textY = buttonRect.y + buttonRect.height / 2 - levelButtonTextSize / 2;
+        DrawText(effect.GetText().c_str(), textX, textY, levelButtonTextSize, BLACK);
+    }
+}
+
+// --- Command-Line Tools ---
+// Headless stress and benchmark modes. They run before the window opens and return the
+// process exit code, or -1 when no tool was requested and the game should start.
+
+// --stress-ooc <width> <height> [cache tiles] [scratch dir]
+int runOutOfCoreStress(int argc, char** argv) {
+    int width = argc > 2 ? atoi(argv[2]) : 20001;
+    int height = argc > 3 ? atoi(argv[3]) : 20001;
+    size_t cacheTiles = argc > 4 ? (size_t)atoll(argv[4]) : 64;
+    string dir = argc > 5 ? argv[5] : ".";
+    if (width % 2 == 0) width++;
+    if (height % 2 == 0) height++;
+
+    TiledGridStore<char> grid((dir + "/maze_grid.ooc").c_str(), width, height, '#', cacheTiles);
+    TiledGridStore<uint8_t> visited((dir + "/maze_visited.ooc").c_str(), width, height, 0, cacheTiles);
+    if (!grid.IsValid() || !visited.IsValid()) return 1;
+
+    Xoshiro256ss gen = makeRngStream<Xoshiro256ss>(chrono::steady_clock::now().time_since_epoch().count(), 0);
+    auto t0 = chrono::steady_clock::now();
+    generateMazeSidewinder(grid, width, height, gen);
+    grid.Flush();
+    auto t1 = chrono::steady_clock::now();
+    TraceLog(LOG_INFO, "OOC: Generated %dx%d (%lld cells) in %.2fs, %llu MB written, hit rate %.4f",
+             width, height, (long long)width * height, chrono::duration<double>(t1 - t0).count(),
+             (unsigned long long)(grid.bytesWritten >> 20), grid.HitRate());
+
+    uint64_t gridReadBefore = grid.bytesRead, gridWrittenBefore = grid.bytesWritten;
+    uint64_t gridHitsBefore = grid.cacheHits, gridMissesBefore = grid.cacheMisses;
+    ExternalBfsResult solved = solveMazeExternalBFS(grid, visited, 1, 1, width - 2, height - 2);
+    auto t2 = chrono::steady_clock::now();
+    uint64_t gridHits = grid.cacheHits - gridHitsBefore, gridMisses = grid.cacheMisses - gridMissesBefore;
+    TraceLog(LOG_INFO, "OOC: Solved in %.2fs: distance %lld, %lld cells reached over %lld levels, frontier spanned up to %lld tiles",
+             chrono::duration<double>(t2 - t1).count(), (long long)solved.distance, (long long)solved.reachedCells, (long long)solved.levels,
+             (long long)solved.peakFrontierTiles);
+    TraceLog(LOG_INFO, "OOC: Maze tiles: %llu MB read, %llu MB written, hit rate %.4f",
+             (unsigned long long)((grid.bytesRead - gridReadBefore) >> 20), (unsigned long long)((grid.bytesWritten - gridWrittenBefore) >> 20),
+             (gridHits + gridMisses) ? (double)gridHits / (gridHits + gridMisses) : 1.0);
+    TraceLog(LOG_INFO, "OOC: Visited tiles: %llu MB read, %llu MB written, hit rate %.4f",
+             (unsigned long long)(visited.bytesRead >> 20), (unsigned long long)(visited.bytesWritten >> 20), visited.HitRate());
+    if ((int64_t)cacheTiles < solved.peakFrontierTiles + OOC_BFS_CACHE_MARGIN) {
+        TraceLog(LOG_WARNING, "OOC: %zu cache tiles is below the BFS working set, so levels kept re-paging tiles; use at least %lld",
+                 cacheTiles, (long long)(solved.peakFrontierTiles + OOC_BFS_CACHE_MARGIN));
+    }
+    if (!grid.IsValid() || !visited.IsValid()) return 1;
+    return solved.distance >= 0 ? 0 : 1;
+}
+
+// --bench-bfs <width> <height> [repetitions] [open]
+int runBfsBenchmark(int argc, char** argv) {
+    mazeWidth = argc > 2 ? atoi(argv[2]) : 2001;
+    mazeHeight = argc > 3 ? atoi(argv[3]) : 2001;
+    int repetitions = argc > 4 ? atoi(argv[4]) : 10;
+    if (mazeWidth % 2 == 0) mazeWidth++;
+    if (mazeHeight % 2 == 0) mazeHeight++;
+
+    // Every queue BFS run draws its distance grid and queue from the arena
+    size_t cells = (size_t)mazeWidth * mazeHeight;
+    levelArena.Reset(levelArenaBytes(mazeWidth, mazeHeight) + repetitions * (cells * 2 * sizeof(int) + 64));
+    generateMazeDFS(1, 1, rng);
+    bool openRoom = argc > 5 && string(argv[5]) == "open";
+    if (openRoom) {
+        // Wide frontiers: every interior tile open, the case word-wide expansion is built for
+        for (int y = 1; y < mazeHeight - 1; ++y) {
+            for (int x = 1; x < mazeWidth - 1; ++x) maze[y][x] = ' ';
+        }
+    }
+    int targetX = mazeWidth - 2, targetY = mazeHeight - 2;
+
+    auto t0 = chrono::steady_clock::now();
+    int queueDistance = -1;
+    for (int r = 0; r < repetitions; ++r) queueDistance = calculateShortestPathLength(1, 1, targetX, targetY);
+    auto t1 = chrono::steady_clock::now();
+
+    BitParallelBFS solver;
+    solver.Load(maze);
+    auto t2 = chrono::steady_clock::now();
+    int bitDistance = -1;
+    for (int r = 0; r < repetitions; ++r) bitDistance = solver.Solve(1, 1, targetX, targetY, true);
+    auto t3 = chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; ++r) solver.Solve(1, 1, targetX, targetY);
+    auto t4 = chrono::steady_clock::now();
+
+    double queueMs = chrono::duration<double, milli>(t1 - t0).count() / repetitions;
+    double bitMs = chrono::duration<double, milli>(t3 - t2).count() / repetitions;
+    double floodMs = chrono::duration<double, milli>(t4 - t3).count() / repetitions;
+    TraceLog(LOG_INFO, "BFS: %dx%d maze, distance queue=%d bit-parallel=%d (%d levels)", mazeWidth, mazeHeight, queueDistance, bitDistance, solver.levels);
+    TraceLog(LOG_INFO, "BFS: queue %.3f ms/solve, bit-parallel %.3f ms/solve (%.2fx), bit-parallel full flood fill %.3f ms",
+             queueMs, bitMs, bitMs > 0 ? queueMs / bitMs : 0.0, floodMs);
+    return queueDistance == bitDistance ? 0 : 1;
+}
+
+// --bench-flow <width> <height> [player moves]
+int runFlowFieldBenchmark(int argc, char** argv) {
+    mazeWidth = argc > 2 ? atoi(argv[2]) : 501;
+    mazeHeight = argc > 3 ? atoi(argv[3]) : 501;
+    int moves = argc > 4 ? atoi(argv[4]) : 200;
+    if (mazeWidth % 2 == 0) mazeWidth++;
+    if (mazeHeight % 2 == 0) mazeHeight++;
+
+    const int enemyCounts[] = {16, 256, 4096, 65536};
+    levelArena.Reset(levelArenaBytes(mazeWidth, mazeHeight) + FlowField::ArenaBytes(mazeWidth, mazeHeight) + EnemySwarm::ArenaBytes(enemyCounts[3]));
+    generateMazeDFS(1, 1, rng);
+    chaseFlow.Attach(mazeWidth, mazeHeight);
+    chaseEnemies.Attach(enemyCounts[3]);
+
+    const int dX[] = {0, 0, 1, -1};
+    const int dY[] = {-1, 1, 0, 0};
+    uniform_int_distribution<int> dirDist(0, 3);
+    for (int wanted : enemyCounts) {
+        int px = 1, py = 1;
+        chaseFlow.Build(maze, px, py);
+        chaseEnemies.Spawn(maze, chaseFlow, wanted, rng);
+
+        double bfsSeconds = 0.0, stepSeconds = 0.0;
+        for (int m = 0; m < moves; ++m) {
+            // Random walk: keep trying directions until one is open
+            int dir;
+            do { dir = dirDist(rng); } while (maze[py + dY[dir]][px + dX[dir]] == '#');
+            px += dX[dir];
+            py += dY[dir];
+
+            auto t0 = chrono::steady_clock::now();
+            chaseFlow.Build(maze, px, py);
+            auto t1 = chrono::steady_clock::now();
+            chaseEnemies.Step(chaseFlow);
+            auto t2 = chrono::steady_clock::now();
+            bfsSeconds += chrono::duration<double>(t1 - t0).count();
+            stepSeconds += chrono::duration<double>(t2 - t1).count();
+        }
+        double bfsMs = bfsSeconds * 1000.0 / moves;
+        double stepMs = stepSeconds * 1000.0 / moves;
+        TraceLog(LOG_INFO, "FLOW: %dx%d, %6d enemies: BFS %.3f ms + steps %.4f ms per move (%.1f ns/enemy); one BFS per enemy would be ~%.1f ms",
+                 mazeWidth, mazeHeight, chaseEnemies.count, bfsMs, stepMs, chaseEnemies.count ? stepMs * 1e6 / chaseEnemies.count : 0.0,
+                 bfsMs * chaseEnemies.count);
+    }
+    return 0;
+}
+
+// --fuzz-validate <mazes> [max size] [scaling size]
+// Generates random-sized mazes with every generator and placement strategy and checks
+// each one with the validator, then times banded validation of one large maze.
+int runValidatorFuzz(int argc, char** argv) {
+    long long count = argc > 2 ? atoll(argv[2]) : 100000;
+    int maxSize = argc > 3 ? atoi(argv[3]) : 81;
+    int scaleSize = argc > 4 ? atoi(argv[4]) : 4001;
+    if (maxSize < 5) maxSize = 5;
+
+    const char* generatorNames[] = {"BFS", "DFS", "Kruskal", "Prim", "Division"};
+    const char* strategyNames[] = {"random", "corners", "left-right"};
+    long long failures[LEVEL_COUNT][3] = {};
+    long long runs[LEVEL_COUNT][3] = {};
+    uint64_t baseSeed = (uint64_t)chrono::steady_clock::now().time_since_epoch().count();
+    uniform_int_distribution<int> sizeDist(5, maxSize); // Even sizes too, the game only ever asks for odd ones
+    mt19937 sizeGen((unsigned)baseSeed);
+
+    // Arena sized once for the largest maze, so every case reuses the same block
+    size_t arenaBytes = levelArenaBytes(maxSize, maxSize);
+    double generateSeconds = 0.0, validateSeconds = 0.0;
+    long long cells = 0;
+    for (long long i = 0; i < count; ++i) {
+        int generator = (int)(i % LEVEL_COUNT);
+        int strategy = (int)((i / LEVEL_COUNT) % 3);
+        mazeWidth = sizeDist(sizeGen);
+        mazeHeight = sizeDist(sizeGen);
+        rng.seed((unsigned)(baseSeed + i));
+
+        auto t0 = chrono::steady_clock::now();
+        levelArena.Reset(arenaBytes);
+        generateLevelMaze(generator);
+        placeEntranceAndExit((EntranceExitStrategy)strategy);
+        auto t1 = chrono::steady_clock::now();
+        MazeValidation result = levelValidator.Validate(maze, playerX, playerY, exitX, exitY);
+        auto t2 = chrono::steady_clock::now();
+
+        generateSeconds += chrono::duration<double>(t1 - t0).count();
+        validateSeconds += chrono::duration<double>(t2 - t1).count();
+        cells += (long long)mazeWidth * mazeHeight;
+        runs[generator][strategy]++;
+        if (!result.IsPerfect()) {
+            if (failures[generator][strategy]++ == 0) {
+                TraceLog(LOG_WARNING, "VALIDATE: %s/%s %dx%d seed %llu failed: border %d endpoints %d connected %d (%lld components) acyclic %d (%lld extra passages)",
+                         generatorNames[generator], strategyNames[strategy], mazeWidth, mazeHeight, (unsigned long long)(baseSeed + i),
+                         result.borderClosed, result.endpointsOpen, result.connected, result.components, result.acyclic,
+                         result.passages - (result.openCells - result.components));
+            }
+        }
+    }
+
+    long long totalFailures = 0;
+    for (int g = 0; g < LEVEL_COUNT; ++g) {
+        for (int s = 0; s < 3; ++s) {
+            totalFailures += failures[g][s];
+            if (failures[g][s]) TraceLog(LOG_WARNING, "VALIDATE: %s/%s: %lld of %lld mazes failed", generatorNames[g], strategyNames[s], failures[g][s], runs[g][s]);
+        }
+    }
+    TraceLog(LOG_INFO, "VALIDATE: %lld mazes up to %dx%d, %lld failures", count, maxSize, maxSize, totalFailures);
+    TraceLog(LOG_INFO, "VALIDATE: %.0f mazes/s generated, %.0f mazes/s generated and validated (validation costs %.1f%% of throughput, %.2f ns/cell)",
+             generateSeconds > 0 ? count / generateSeconds : 0.0, count / (generateSeconds + validateSeconds),
+             100.0 * validateSeconds / (generateSeconds + validateSeconds), cells ? validateSeconds * 1e9 / cells : 0.0);
+
+    if (scaleSize >= 5) {
+        mazeWidth = mazeHeight = scaleSize | 1;
+        levelArena.Reset(levelArenaBytes(mazeWidth, mazeHeight));
+        generateMazeDFS(1, 1, rng);
+        int hardwareThreads = (int)max(1u, thread::hardware_concurrency());
+        double singleMs = 0.0;
+        for (int threads = 1; threads <= hardwareThreads; threads *= 2) {
+            auto t0 = chrono::steady_clock::now();
+            MazeValidation result = levelValidator.Validate(maze, 1, 1, mazeWidth - 2, mazeHeight - 2, threads);
+            double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+            if (threads == 1) singleMs = ms;
+            TraceLog(LOG_INFO, "VALIDATE: %dx%d with %2d threads: %.2f ms (%.2fx), perfect %d",
+                     mazeWidth, mazeHeight, threads, ms, ms > 0 ? singleMs / ms : 0.0, result.IsPerfect());
+            if (!result.IsPerfect()) totalFailures++;
+        }
+    }
+    return totalFailures == 0 ? 0 : 1;
+}
+
+// --bench-division <width> <height> [max threads]
+// Generates the same recursive-division maze on 1, 2, 4 ... threads, checks that every run
+// produced the identical grid and that it is a perfect maze, and reports the speedup.
+int runDivisionBenchmark(int argc, char** argv) {
+    mazeWidth = argc > 2 ? atoi(argv[2]) : 8001;
+    mazeHeight = argc > 3 ? atoi(argv[3]) : 8001;
+    int maxThreads = argc > 4 ? atoi(argv[4]) : (int)max(1u, thread::hardware_concurrency());
+    if (mazeWidth % 2 == 0) mazeWidth++;
+    if (mazeHeight % 2 == 0) mazeHeight++;
+
+    size_t cells = (size_t)mazeWidth * mazeHeight;
+    uint64_t seed = (uint64_t)chrono::steady_clock::now().time_since_epoch().count();
+    uint64_t firstHash = 0;
+    double singleMs = 0.0;
+    bool ok = true;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        levelArena.Reset(cells + divisionStackBytes(mazeWidth, mazeHeight) + 64);
+        resetMazeGrid();
+        auto t0 = chrono::steady_clock::now();
+        generateMazeDivision(maze, seed, threads);
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+
+        uint64_t hash = 1469598103934665603ULL; // FNV-1a over the whole grid
+        for (size_t i = 0; i < cells; ++i) hash = (hash ^ (unsigned char)maze.cells[i]) * 1099511628211ULL;
+        if (threads == 1) {
+            singleMs = ms;
+            firstHash = hash;
+            MazeValidation result = levelValidator.Validate(maze, 1, 1, mazeWidth - 2, mazeHeight - 2);
+            TraceLog(LOG_INFO, "DIVISION: %dx%d maze is %s (%lld open cells, %lld components)", mazeWidth, mazeHeight,
+                     result.IsPerfect() ? "perfect" : "NOT perfect", result.openCells, result.components);
+            ok = ok && result.IsPerfect();
+        }
+        ok = ok && hash == firstHash;
+        TraceLog(LOG_INFO, "DIVISION: %2d threads: %.1f ms, %.1f Mcells/s, speedup %.2fx, %lld steals, grid %s",
+                 threads, ms, ms > 0 ? cells / (ms * 1000.0) : 0.0, ms > 0 ? singleMs / ms : 0.0,
+                 threads > 1 ? generationPool.steals.load() : 0LL, hash == firstHash ? "identical" : "DIFFERENT");
+    }
+    return ok ? 0 : 1;
+}
+
+int runCommandLineTool(int argc, char** argv) {
+    if (argc < 2) return -1;
+    string tool = argv[1];
+    if (tool == "--stress-ooc") return runOutOfCoreStress(argc, argv);
+    if (tool == "--bench-bfs") return runBfsBenchmark(argc, argv);
+    if (tool == "--bench-flow") return runFlowFieldBenchmark(argc, argv);
+    if (tool == "--fuzz-validate") return runValidatorFuzz(argc, argv);
+    if (tool == "--bench-division") return runDivisionBenchmark(argc, argv);
+    TraceLog(LOG_WARNING, "Unknown option %s", argv[1]);
+    return -1;
+}
+
 // --- Main Game Loop ---
-int main() {
+int main(int argc, char** argv) {
+    int toolExitCode = runCommandLineTool(argc, argv);
+    if (toolExitCode >= 0) return toolExitCode;
+
     InitWindow(fixedScreenWidth, fixedScreenHeight, "Raylib Maze Game"); 
     SetTargetFPS(60);
     
@@ -635,78 +2912,41 @@ int main() {
         TraceLog(LOG_WARNING, "LOGO: Failed to load assets/logo.jpg. Ensure the file exists and path is correct. Using a default background color for the logo area instead.");
     }
 
-    welcomeTextAnim.Start("Welcome to MAZE Game!", 20.0f);
-    pressEnterTextEffect.Init("Press ENTER to Start", &rng);
+    welcomeTextAnim.Start("Welcome to MAZE Game!", 20.0f, welcomeTextSize);
+    pressEnterTextEffect.Init("Press ENTER to Start", &rng, pressEnterTextSize);
 
-    for (int i = 0; i < 4; ++i) {
-        levelButtonsTextEffects[i].Init(levelNames[i], &rng);
+    for (int i = 0; i < LEVEL_COUNT; ++i) {
+        levelButtonsTextEffects[i].Init(levelNames[i], &rng, levelButtonTextSize);
     }
+    buildStaticMenuLayouts();
+    buildLevelSelectModesLayout();
     
     while (!WindowShouldClose()) {
         float deltaTime = GetFrameTime();
+        if (discardNextFrameTime) {
+            deltaTime = 0.0f; // Includes the event-waiting sleep, see updateEventWaiting()
+            discardNextFrameTime = false;
+        }
+        size_t allocationsAtFrameStart = allocationCount.load(memory_order_relaxed);
+        double frameStartWall = GetTime();
+        clock_t frameStartCpu = clock();
+        loadEventThisFrame = false;
+
+        if (IsKeyPressed(KEY_F1)) showFrameStats = !showFrameStats;
 
         switch (currentScreen) {
             case HOME: {
-                welcomeTextAnim.Update(deltaTime);
-                Rectangle pressEnterRect = {
-                    (float)GetScreenWidth() / 2 - MeasureText(pressEnterTextEffect.originalText.c_str(), 30) / 2,
-                    (float)GetScreenHeight() / 2 + 100,
-                    (float)MeasureText(pressEnterTextEffect.originalText.c_str(), 30),
-                    30.0f
-                };
-                if (CheckCollisionPointRec(GetMousePosition(), pressEnterRect)) {
-                    pressEnterTextEffect.Start();
-                } else {
-                    pressEnterTextEffect.Stop();
-                }
-                pressEnterTextEffect.GetText(deltaTime);
-                
-                if (IsKeyPressed(KEY_ENTER)) {
-                    currentScreen = LEVEL_SELECT;
-                }
+                updateHomeScreen(deltaTime);
             } break;
             case LEVEL_SELECT: {
-                int buttonTextSize = 30;
-                for (int i = 0; i < 4; ++i) {
-                    Rectangle buttonRect = {(float)GetScreenWidth()/2 - 150, (float)(150 + i * 80), 300, 60};
-                    
-                    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-                    bool buttonPressed = GuiButton(buttonRect, "");
-                    
-                    const char* buttonDisplayName = levelButtonsTextEffects[i].GetText(deltaTime).c_str();
-                    
-                    float textX = buttonRect.x + buttonRect.width / 2 - MeasureText(buttonDisplayName, buttonTextSize) / 2;
-                    float textY = buttonRect.y + buttonRect.height / 2 - buttonTextSize / 2;
-                    DrawText(buttonDisplayName, textX, textY, buttonTextSize, BLACK);
-
-                    if (CheckCollisionPointRec(GetMousePosition(), buttonRect)) {
-                        levelButtonsTextEffects[i].Start();
-                    } else {
-                        levelButtonsTextEffects[i].Stop();
-                    }
-                    levelButtonsTextEffects[i].GetText(deltaTime); // Update effect even if not pressed
-
-                    if (buttonPressed) {
-                        // Select strategy based on level for now
-                        EntranceExitStrategy strategy;
-                        if (i == 0 || i == 1) { // Easy and Medium are random
-                            strategy = RANDOM_PLACEMENT;
-                        } else if (i == 2) { // Hard is top-left to bottom-right
-                            strategy = TOP_LEFT_BOTTOM_RIGHT;
-                        } else { // Very Hard is left-center to right-center
-                            strategy = LEFT_RIGHT_CENTER;
-                        }
-                        setupGame(i, strategy);
-                        currentScreen = GAMEPLAY;
-                    }
-                }
+                updateLevelSelectScreen(deltaTime);
             } break;
             // main() ফাংশনের ভেতরে, case GAMEPLAY: এর লজিক আপডেট করুন
             case GAMEPLAY: {
-                totalTime += GetFrameTime();
+                float dt = min(deltaTime, MAX_GAMEPLAY_FRAME_TIME);
+                totalTime += dt;
                 handleGameplayInput();
                 
-                float dt = GetFrameTime();
 
                 // 🚀 1. Player Smooth Movement Update (EASING)
                 // playerRenderX/Y কে টার্গেট পজিশন playerX/Y এর দিকে মসৃণভাবে মুভ করাবে
@@ -720,9 +2960,20 @@ int main() {
                 // ⭐⭐ Exit Sign Pulse Update - Speed Increased to 8.0f ⭐⭐
                 pulseTimer += dt * 8.0f; // 8.0f মানে এখন দ্বিগুণ দ্রুত পালস হবে
                 if (pulseTimer > PI * 2) pulseTimer -= PI * 2;
+
+                // 🏃 3. Chase Mode Update
+                // Each outcome ends the frame's gameplay: an enemy can stand on the exit, and a
+                // caught player must not still reach the win check below
+                if (chaseModeEnabled && updateChaseMode(dt)) {
+                    gameOverMessage = "Caught! An enemy reached you.";
+                    changeScreen(GAMEOVER);
+                    break;
+                }
                 
                 if (totalTime > levelTimeLimits[currentLevelIndex]) {
-                    currentScreen = GAMEOVER;
+                    gameOverMessage = "Time's up! You couldn't solve the maze.";
+                    changeScreen(GAMEOVER);
+                    break;
                 }
                         
                 // --- INSIDE case GAMEPLAY: ---
@@ -750,21 +3001,26 @@ int main() {
                         accuracy = 100.0f;
                     }
 
-                    currentScreen = WIN;
+                    changeScreen(WIN);
                 }
             } break;
             case WIN: {
                 if (IsKeyPressed(KEY_ENTER)) {
-                    currentScreen = LEVEL_SELECT;
+                    changeScreen(LEVEL_SELECT);
                 }
             } break;
             case GAMEOVER: {
                 if (IsKeyPressed(KEY_ENTER)) {
-                    currentScreen = LEVEL_SELECT;
+                    changeScreen(LEVEL_SELECT);
                 }
             } break;
+            case EDITOR: {
+                updateEditorScreen();
+            } break;
         }
 
+        updateEventWaiting();
+
         BeginDrawing();
     
     // // Dot Background Pattern
@@ -804,73 +3060,10 @@ int main() {
 
         switch (currentScreen) {
             case HOME: {
-                if (logoTexture.id != 0) {
-                    float scale = 0.4f;
-                    float logoX = GetScreenWidth() / 2 - (logoTexture.width * scale) / 2;
-                    float logoY = GetScreenHeight() / 2 - (logoTexture.height * scale) / 2 - 150;
-                    DrawTextureEx(logoTexture, {logoX, logoY}, 0.0f, scale, WHITE);
-                } else {
-                    // Placeholder for logo if it fails to load
-                    Rectangle logoPlaceholder = { (float)GetScreenWidth() / 2 - 100, (float)GetScreenHeight() / 2 - 250, 200, 100 };
-                    DrawRectangleRec(logoPlaceholder, LIGHTGRAY);
-                    DrawText("LOGO", logoPlaceholder.x + logoPlaceholder.width/2 - MeasureText("LOGO", 30)/2, logoPlaceholder.y + logoPlaceholder.height/2 - 15, 30, GRAY);
-                }
-
-                int welcomeTextSize = 50;
-                float welcomeTextX = GetScreenWidth() / 2 - MeasureText(welcomeTextAnim.displayedText.c_str(), welcomeTextSize) / 2;
-                float welcomeTextY = GetScreenHeight() / 2 - welcomeTextSize / 2;
-                DrawText(welcomeTextAnim.displayedText.c_str(), welcomeTextX, welcomeTextY, welcomeTextSize, DARKBLUE);
-                
-                int pressEnterTextSize = 30;
-                const char* pressEnterDisplay = pressEnterTextEffect.GetText(deltaTime).c_str();
-                float pressEnterTextX = GetScreenWidth() / 2 - MeasureText(pressEnterDisplay, pressEnterTextSize) / 2;
-                float pressEnterTextY = GetScreenHeight() / 2 + 100;
-                DrawText(pressEnterDisplay, pressEnterTextX, pressEnterTextY, pressEnterTextSize, DARKGRAY);
-
+                drawHomeScreen();
             } break;
             case LEVEL_SELECT: {
-                int selectLevelTextSize = 40;
-                DrawText("Select Level:", GetScreenWidth() / 2 - MeasureText("Select Level:", selectLevelTextSize) / 2, 50, selectLevelTextSize, BLACK);
-                
-                int buttonYStart = 150;
-                int buttonSpacing = 80;
-                int buttonWidth = 300;
-                int buttonHeight = 60;
-                int buttonTextSize = 30;
-
-                for(int i = 0; i < 4; ++i) {
-                    Rectangle buttonRect = {(float)GetScreenWidth()/2 - buttonWidth/2, (float)(buttonYStart + i * buttonSpacing), (float)buttonWidth, (float)buttonHeight};
-                    
-                    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-                    bool buttonPressed = GuiButton(buttonRect, "");
-                    
-                    const char* buttonDisplayName = levelButtonsTextEffects[i].GetText(deltaTime).c_str();
-                    
-                    float textX = buttonRect.x + buttonRect.width / 2 - MeasureText(buttonDisplayName, buttonTextSize) / 2;
-                    float textY = buttonRect.y + buttonRect.height / 2 - buttonTextSize / 2;
-                    DrawText(buttonDisplayName, textX, textY, buttonTextSize, BLACK);
-
-                    if (CheckCollisionPointRec(GetMousePosition(), buttonRect)) {
-                        levelButtonsTextEffects[i].Start();
-                    } else {
-                        levelButtonsTextEffects[i].Stop();
-                    }
-                    levelButtonsTextEffects[i].GetText(deltaTime); // Update effect even if not pressed
-
-                    if (buttonPressed) {
-                        // Select strategy based on level for now
-                        EntranceExitStrategy strategy;
-                        if (i == 0 || i == 1) { // Easy and Medium are random
-                            strategy = RANDOM_PLACEMENT;
-                        } else if (i == 2) { // Hard is top-left to bottom-right
-                            strategy = TOP_LEFT_BOTTOM_RIGHT;
-                        } else { // Very Hard is left-center to right-center
-                            strategy = LEFT_RIGHT_CENTER;
-                        }
-                        setupGame(i, strategy);
-                        currentScreen = GAMEPLAY;
-                    }
-                }
+                drawLevelSelectScreen();
             } break;
             case GAMEPLAY: {
                 drawMaze();
@@ -879,6 +3072,7 @@ int main() {
                 DrawCircle((float)(playerRenderX * TILE_SIZE + mazeOffsetX + TILE_SIZE / 2), // ⭐ এখানে পরিবর্তন
                         (float)(playerRenderY * TILE_SIZE + mazeOffsetY + TILE_SIZE / 2), // ⭐ এখানে পরিবর্তন
                         TILE_SIZE / 2 - 2, BLUE);
+                if (chaseModeEnabled) drawChaseEnemies();
 
                 Rectangle hudBackground = { 0, 0, (float)GetScreenWidth(), 70 };
                 DrawRectangleRec(hudBackground, GetColor(0xE0E0E0FF)); // Lighter gray HUD background
@@ -891,22 +3085,35 @@ int main() {
                 DrawText(TextFormat("Ideal: %i", idealMoves), GetScreenWidth() - MeasureText(TextFormat("Ideal: %i", idealMoves), 20) - 10, 10, 20, DARKBLUE);
             } break;
             case WIN: {
-                DrawText("You Won!", GetScreenWidth() / 2 - MeasureText("You Won!", 40) / 2, GetScreenHeight() / 2 - 80, 40, DARKGREEN);
-                DrawText(TextFormat("Time Taken: %.2f seconds", totalTime), GetScreenWidth() / 2 - MeasureText("Time Taken: 00.00 seconds", 20) / 2, GetScreenHeight() / 2 - 30, 20, BLACK);
-                DrawText(TextFormat("Total Moves: %i", totalMoves), GetScreenWidth() / 2 - MeasureText("Total Moves: 0000", 20) / 2, GetScreenHeight() / 2 + 0, 20, BLACK);
-                DrawText(TextFormat("Ideal Moves: %i", idealMoves), GetScreenWidth() / 2 - MeasureText(TextFormat("Ideal Moves: %i", idealMoves), 20) / 2, GetScreenHeight() / 2 + 30, 20, BLACK);
-                DrawText(TextFormat("Accuracy: %.2f%%", accuracy), GetScreenWidth() / 2 - MeasureText(TextFormat("Accuracy: %.2f%%", accuracy), 30) / 2, GetScreenHeight() / 2 + 70, 30, (accuracy >= 80.0f) ? BLUE : RED);
-                DrawText("Press ENTER to go to Level Select", GetScreenWidth() / 2 - 200, GetScreenHeight() / 2 + 120, 20, GRAY);
+                winLayout.Draw();
             } break;
             case GAMEOVER: {
-                DrawText("GAME OVER!", GetScreenWidth() / 2 - MeasureText("GAME OVER!", 40) / 2, GetScreenHeight() / 2 - 80, 40, RED);
-                DrawText(TextFormat("Time's up! You couldn't solve the maze."), GetScreenWidth()/2 - MeasureText("Time's up! You couldn't solve the maze.", 20)/2, GetScreenHeight()/2, 20, BLACK);
-                DrawText("Press ENTER to go to Level Select", GetScreenWidth() / 2 - 200, GetScreenHeight() / 2 + 30, 20, GRAY);
+                gameOverLayout.Draw();
+            } break;
+            case EDITOR: {
+                drawEditorScreen();
             } break;
         }
-        EndDrawing();
+
+        if (showFrameStats) {
+            const ScreenPacing& pacing = screenPacing[currentScreen];
+            DrawText(TextFormat("%s: %.1f wakeups/s, %.1f%% CPU%s", screenNames[currentScreen], pacing.wakeupsPerSecond, pacing.cpuPercent,
+                                eventWaitingActive ? " (idle)" : ""), 10, GetScreenHeight() - 50, 20, MAROON);
+            DrawText(TextFormat("Allocs/frame: %zu (steady peak %zu)", frameAllocations, peakSteadyFrameAllocations), 10, GetScreenHeight() - 25, 20, MAROON);
+        }
+        GameScreen frameScreen = currentScreen;
+        EndDrawing(); // Sleeps here until the next input event while event waiting is on
+
+        screenPacing[frameScreen].AddFrame(GetTime() - frameStartWall, (double)(clock() - frameStartCpu) / CLOCKS_PER_SEC);
+
+        frameAllocations = allocationCount.load(memory_order_relaxed) - allocationsAtFrameStart;
+        if (!loadEventThisFrame && frameAllocations > peakSteadyFrameAllocations) {
+            peakSteadyFrameAllocations = frameAllocations;
+        }
     }
 
+    endScreenVisit(currentScreen);
+
     if (logoTexture.id != 0) {
         UnloadTexture(logoTexture);
     }